@@ -0,0 +1,61 @@
+#include <algorithm>  // for min
+#include <cstdint>
+#include <ecgen/bipart_cut.hpp>
+#include <tuple>
+#include <vector>
+
+#include "benchmark/benchmark.h"  // for BENCHMARK, State, BENCHMARK_...
+
+/**
+ * @brief A ring of n vertices with chords to the vertex three steps ahead
+ *
+ * @param[in] n
+ * @return ecgen::CsrGraph<int>
+ */
+static auto ring_graph(int n) -> ecgen::CsrGraph<int> {
+    auto edges = std::vector<std::tuple<int, int, int>>{};
+    for (int v = 0; v != n; ++v) {
+        edges.emplace_back(v, (v + 1) % n, 2);
+        edges.emplace_back(v, (v + 3) % n, 1);
+    }
+    return ecgen::CsrGraph<int>::from_edges(n, edges);
+}
+
+/**
+ * The function `bipart_cut_full` recomputes the cut weight of every
+ * bipartition from scratch.
+ *
+ * @param[in,out] state The benchmark state; `state.range(0)` is n.
+ */
+static void bipart_cut_full(benchmark::State& state) {
+    const auto graph = ring_graph(static_cast<int>(state.range(0)));
+    while (state.KeepRunning()) {
+        auto iter = ecgen::SetBipartIterator(graph.num_vertices());
+        auto best = graph.cut_weight(iter.mask());
+        while (iter.next()) {
+            best = std::min(best, graph.cut_weight(iter.mask()));
+        }
+        benchmark::DoNotOptimize(best);
+    }
+}
+
+// Register the function as a benchmark
+BENCHMARK(bipart_cut_full)->Arg(16)->Arg(20)->Unit(benchmark::kMillisecond);
+
+//~~~~~~~~~~~~~~~~
+
+/**
+ * The function `bipart_cut_incremental` updates the cut weight in O(degree)
+ * per move with `bipart_cut_sweep`.
+ *
+ * @param[in,out] state The benchmark state; `state.range(0)` is n.
+ */
+static void bipart_cut_incremental(benchmark::State& state) {
+    const auto graph = ring_graph(static_cast<int>(state.range(0)));
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(ecgen::bipart_cut_sweep(graph).cut);
+    }
+}
+BENCHMARK(bipart_cut_incremental)->Arg(16)->Arg(20)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,92 @@
+#include <cstdint>
+#include <ecgen/combin.hpp>
+#include <ecgen/coollex.hpp>
+
+#include "benchmark/benchmark.h"  // for BENCHMARK, State, BENCHMARK_...
+
+/**
+ * The function `comb_emk` enumerates the transitions of all k-combinations of
+ * n elements with the revolving-door generator `emk_comb_gen`.
+ *
+ * @param[in,out] state The benchmark state; `state.range(0)` is n and
+ * `state.range(1)` is k.
+ */
+static void comb_emk(benchmark::State& state) {
+    const auto n = static_cast<int>(state.range(0));
+    const auto k = static_cast<int>(state.range(1));
+    while (state.KeepRunning()) {
+        size_t cnt = 1;
+        for ([[maybe_unused]] auto [x, y] : ecgen::emk_comb_gen(n, k)) {
+            ++cnt;
+        }
+        benchmark::DoNotOptimize(cnt);
+    }
+}
+
+/**
+ * The function `comb_coollex_mask` enumerates all k-combinations of n
+ * elements as bit masks in cool-lex order.
+ *
+ * @param[in,out] state The benchmark state; `state.range(0)` is n and
+ * `state.range(1)` is k.
+ */
+static void comb_coollex_mask(benchmark::State& state) {
+    const auto n = static_cast<int>(state.range(0));
+    const auto k = static_cast<int>(state.range(1));
+    while (state.KeepRunning()) {
+        std::uint64_t acc = 0;
+        for (const auto& comb : ecgen::coollex_comb(n, k)) {
+            acc += comb.mask();
+        }
+        benchmark::DoNotOptimize(acc);
+    }
+}
+
+/**
+ * The function `comb_coollex_swaps` enumerates all k-combinations of n
+ * elements in cool-lex order as transpositions, like `emk_comb_gen`.
+ *
+ * @param[in,out] state The benchmark state; `state.range(0)` is n and
+ * `state.range(1)` is k.
+ */
+static void comb_coollex_swaps(benchmark::State& state) {
+    const auto n = static_cast<int>(state.range(0));
+    const auto k = static_cast<int>(state.range(1));
+    while (state.KeepRunning()) {
+        size_t cnt = 1;
+        for (const auto& comb : ecgen::coollex_comb(n, k)) {
+            comb.for_each_swap([&cnt](int x, int y) { cnt += size_t(x ^ y); });
+        }
+        benchmark::DoNotOptimize(cnt);
+    }
+}
+
+// Register the function as a benchmark
+BENCHMARK(comb_emk)->Args({16, 5})->Args({32, 8})->Args({48, 6})->Unit(benchmark::kMillisecond);
+BENCHMARK(comb_coollex_mask)
+    ->Args({16, 5})
+    ->Args({32, 8})
+    ->Args({48, 6})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(comb_coollex_swaps)
+    ->Args({16, 5})
+    ->Args({32, 8})
+    ->Args({48, 6})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
+
+/*
+----------------------------------------------------------------
+Benchmark                         Time             CPU   Iterations
+----------------------------------------------------------------
+comb_emk/16/5                 0.088 ms        0.088 ms         7954
+comb_emk/32/8                   168 ms          168 ms            4
+comb_emk/48/6                   171 ms          171 ms            4
+comb_coollex_mask/16/5        0.011 ms        0.011 ms        63412
+comb_coollex_mask/32/8         24.8 ms         24.8 ms           28
+comb_coollex_mask/48/6         28.8 ms         28.8 ms           24
+comb_coollex_swaps/16/5       0.022 ms        0.022 ms        31706
+comb_coollex_swaps/32/8        49.7 ms         49.7 ms           14
+comb_coollex_swaps/48/6        56.3 ms         56.3 ms           12
+*/
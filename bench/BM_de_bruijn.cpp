@@ -0,0 +1,57 @@
+#include <cstdint>
+#include <ecgen/de_bruijn.hpp>
+#include <vector>
+
+#include "benchmark/benchmark.h"  // for BENCHMARK, State, BENCHMARK_...
+
+/**
+ * The function `de_bruijn_read` streams the whole binary de Bruijn sequence
+ * B(2, n) through a 64 KiB buffer.
+ *
+ * @param[in,out] state The benchmark state; `state.range(0)` is n.
+ */
+static void de_bruijn_read(benchmark::State& state) {
+    const auto n = static_cast<int>(state.range(0));
+    auto chunk = std::vector<std::uint8_t>(std::size_t(1) << 16);
+    while (state.KeepRunning()) {
+        auto stream = ecgen::DeBruijnStream(2, n);
+        std::uint64_t acc = 0;
+        while (const auto count = stream.read(chunk)) {
+            acc += chunk[count - 1];
+        }
+        benchmark::DoNotOptimize(acc);
+    }
+}
+
+/**
+ * The function `de_bruijn_seek` moves to the middle of B(2, n) and reads
+ * one 4 KiB chunk.
+ *
+ * @param[in,out] state The benchmark state; `state.range(0)` is n.
+ */
+static void de_bruijn_seek(benchmark::State& state) {
+    const auto n = static_cast<int>(state.range(0));
+    auto chunk = std::vector<std::uint8_t>(4096);
+    auto stream = ecgen::DeBruijnStream(2, n);
+    while (state.KeepRunning()) {
+        stream.seek(stream.length() / 2);
+        benchmark::DoNotOptimize(stream.read(chunk));
+    }
+}
+
+// Register the function as a benchmark
+BENCHMARK(de_bruijn_read)->Arg(20)->Arg(26)->Unit(benchmark::kMillisecond);
+BENCHMARK(de_bruijn_seek)->Arg(20)->Arg(32)->Arg(48)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
+
+/*
+----------------------------------------------------------------
+Benchmark                      Time             CPU   Iterations
+----------------------------------------------------------------
+de_bruijn_read/20          0.855 ms        0.855 ms          818
+de_bruijn_read/26           33.5 ms         33.5 ms           21
+de_bruijn_seek/20          0.358 ms        0.358 ms         1955
+de_bruijn_seek/32           1.70 ms         1.70 ms          413
+de_bruijn_seek/48           6.87 ms         6.87 ms          102
+*/
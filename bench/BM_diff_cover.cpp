@@ -0,0 +1,25 @@
+#include <ecgen/diff_cover.hpp>
+#include <vector>
+
+#include "benchmark/benchmark.h"  // for BENCHMARK, State, BENCHMARK_...
+
+/**
+ * The function `diff_cover_all` enumerates all difference covers of Z_n with
+ * d elements on a single thread.
+ *
+ * @param[in,out] state The benchmark state; `state.range(0)` is n and
+ * `state.range(1)` is d.
+ */
+static void diff_cover_all(benchmark::State& state) {
+    const auto n = static_cast<int>(state.range(0));
+    const auto d = static_cast<int>(state.range(1));
+    while (state.KeepRunning()) {
+        auto search = ecgen::DiffCoverSearch(n, d);
+        benchmark::DoNotOptimize(search.find_all(1).size());
+    }
+}
+
+// Register the function as a benchmark
+BENCHMARK(diff_cover_all)->Args({44, 8})->Args({73, 9})->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
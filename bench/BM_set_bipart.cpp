@@ -0,0 +1,46 @@
+#include <cstdint>
+#include <ecgen/set_bipart.hpp>
+
+#include "benchmark/benchmark.h"  // for BENCHMARK, State, BENCHMARK_...
+
+/**
+ * The function `set_bipart_coroutine` enumerates all bipartitions of n
+ * elements with the coroutine-based `set_bipart_gen`, applying each move to a
+ * bit mask.
+ *
+ * @param[in,out] state The benchmark state; `state.range(0)` is n.
+ */
+static void set_bipart_coroutine(benchmark::State& state) {
+    const auto n = static_cast<int>(state.range(0));
+    while (state.KeepRunning()) {
+        auto mask = std::uint64_t{1} << (n - 1);
+        for (auto idx : ecgen::set_bipart_gen(n)) {
+            mask ^= std::uint64_t{1} << (idx - 1);
+        }
+        benchmark::DoNotOptimize(mask);
+    }
+}
+
+// Register the function as a benchmark
+BENCHMARK(set_bipart_coroutine)->Arg(10)->Arg(20)->Arg(30)->Unit(benchmark::kMillisecond);
+
+//~~~~~~~~~~~~~~~~
+
+/**
+ * The function `set_bipart_iterator` enumerates the same move sequence with
+ * the allocation-free `SetBipartIterator`.
+ *
+ * @param[in,out] state The benchmark state; `state.range(0)` is n.
+ */
+static void set_bipart_iterator(benchmark::State& state) {
+    const auto n = static_cast<int>(state.range(0));
+    while (state.KeepRunning()) {
+        auto iter = ecgen::SetBipartIterator(n);
+        while (iter.next()) {
+            benchmark::DoNotOptimize(iter.mask());
+        }
+    }
+}
+BENCHMARK(set_bipart_iterator)->Arg(10)->Arg(20)->Arg(30)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
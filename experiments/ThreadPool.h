@@ -1,149 +0,0 @@
-/**
- * @file ThreadPool.h
- * @brief Thread Pool implementation for parallel task execution
- *
- * A thread pool that manages a fixed number of worker threads for executing
- * tasks in parallel. Tasks are submitted via the enqueue method and executed
- * by available worker threads.
- */
-
-#ifndef THREAD_POOL_H
-#define THREAD_POOL_H
-
-#include <condition_variable>
-#include <functional>
-#include <future>
-#include <memory>
-#include <mutex>
-#include <queue>
-#include <stdexcept>
-#include <thread>
-#include <vector>
-
-/**
- * @brief Thread Pool class
- *
- * A thread pool that manages a fixed number of worker threads for parallel
- * task execution. Tasks are submitted via the enqueue method and executed
- * by available worker threads.
- *
- * The pool uses a work-stealing pattern where worker threads wait on a
- * condition variable for new tasks. When a task is enqueued, one worker
- * is notified to process it.
- */
-class ThreadPool {
-  public:
-    /**
-     * @brief Construct a thread pool with the specified number of threads
-     *
-     * Creates a thread pool with the given number of worker threads.
-     * Each thread runs continuously, waiting for tasks to execute.
-     *
-     * @param[in] threads Number of worker threads to create
-     */
-    ThreadPool(size_t);
-
-    /**
-     * @brief Enqueue a task for execution
-     *
-     * Adds a new task to the thread pool's work queue. The task will be
-     * executed by an available worker thread. Returns a future that can be
-     * used to retrieve the result of the task.
-     *
-     * @tparam F Function type
-     * @tparam Args Argument types
-     * @param[in] f The function to execute
-     * @param[in] args Arguments to pass to the function
-     * @return std::future containing the result of the function
-     * @throws std::runtime_error if enqueue is called after stopping the pool
-     */
-    template <class F, class... Args> auto enqueue(F&& f, Args&&... args)
-#if __cplusplus >= 201703L
-        -> std::future<typename std::invoke_result<F, Args...>::type>;
-#else
-        -> std::future<typename std::result_of<F(Args...)>::type>;
-#endif
-
-    /**
-     * @brief Destructor - stops all threads and joins them
-     *
-     * Signals all worker threads to stop, notifies all waiting threads,
-     * and joins all threads. All pending tasks will be executed before
-     * the threads terminate.
-     */
-    ~ThreadPool();
-
-  private:
-    // need to keep track of threads so we can join them
-    std::vector<std::thread> workers;
-    // the task queue
-    std::queue<std::function<void()>> tasks;
-
-    // synchronization
-    std::mutex queue_mutex;
-    std::condition_variable condition;
-    bool stop;
-};
-
-// the constructor just launches some amount of workers
-inline ThreadPool::ThreadPool(size_t threads) : stop(false) {
-    for (size_t i = 0; i < threads; ++i)
-        workers.emplace_back([this] {
-            for (;;) {
-                std::function<void()> task;
-
-                {
-                    std::unique_lock<std::mutex> lock(this->queue_mutex);
-                    this->condition.wait(lock,
-                                         [this] { return this->stop || !this->tasks.empty(); });
-                    if (this->stop && this->tasks.empty()) return;
-                    task = std::move(this->tasks.front());
-                    this->tasks.pop();
-                }
-
-                task();
-            }
-        });
-}
-
-// add new work item to the pool
-template <class F, class... Args> auto ThreadPool::enqueue(F&& f, Args&&... args)
-#if __cplusplus >= 201703L
-    -> std::future<typename std::invoke_result<F, Args...>::type>
-#else
-    -> std::future<typename std::result_of<F(Args...)>::type>
-#endif
-{
-#if __cplusplus >= 201703L
-    using return_type = typename std::invoke_result<F, Args...>::type;
-#else
-    using return_type = typename std::result_of<F(Args...)>::type;
-#endif
-
-    auto task = std::make_shared<std::packaged_task<return_type()>>(
-        std::bind(std::forward<F>(f), std::forward<Args>(args)...));
-
-    std::future<return_type> res = task->get_future();
-    {
-        std::unique_lock<std::mutex> lock(queue_mutex);
-
-        // don't allow enqueueing after stopping the pool
-        if (stop) throw std::runtime_error("enqueue on stopped ThreadPool");
-
-        tasks.emplace([task]() { (*task)(); });
-    }
-    condition.notify_one();
-    return res;
-}
-
-// the destructor joins all threads
-inline ThreadPool::~ThreadPool() {
-    {
-        std::unique_lock<std::mutex> lock(queue_mutex);
-        stop = true;
-    }
-    condition.notify_all();
-    for (std::thread& worker : workers) worker.join();
-}
-
-#endif
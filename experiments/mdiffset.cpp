@@ -14,14 +14,14 @@
  * You should have received a copy of the GNU General Public License
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
+#include <algorithm>  // for max
+#include <atomic>
 #include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
-#include <future>  // for future
-#include <vector>
-
-#include "ThreadPool.h"
+#include <ecgen/work_stealing_pool.hpp>
+#include <thread>
 
 const auto MAX = 20;
 const auto MAX_N = 70;
@@ -158,31 +158,27 @@ int main(int argc, char** argv) {
     // printf("%3d\n", end);
     // diff_cover.run();
 
-    auto num_workers = std::thread::hardware_concurrency() / 2;
-    ThreadPool pool(num_workers);
-    printf("Number of workers: %d\n", num_workers);
-    std::vector<std::future<void>> results;
+    auto num_workers = std::max(1U, std::thread::hardware_concurrency() / 2);
+    ecgen::WorkStealingPool pool(num_workers);
+    printf("Number of workers: %u\n", num_workers);
     auto start = (n + 1) / 2;
     auto end = (n - 1) / d + 1;
 
+    // the branches left, counted down as they finish
+    std::atomic<int> countdown{start - end + 1};
+
     // for (auto j = n - d + 1; j >= end; j--) {
-    for (auto j = start; j >= end; j--) {
-        results.emplace_back(pool.enqueue([&n, &d, &threshold, j]() {
-            DiffCover dc(n, d, threshold);
-            dc.a[1] = j;
-            dc.b[1] = 1;
-            int8_t differences[MAX_N];
-            memset(differences, 0, dc.size_n);
-            differences[0] = 1;
-            dc.GenD(1, 1, 1, differences);
-        }));
-    }
-    auto countdown = start - end;
-    for (auto&& result : results) {
-        printf("%3d\r", countdown--);
+    pool.parallel_for(0, std::size_t(start - end + 1), [&, start](std::size_t i) {
+        DiffCover dc(n, d, threshold);
+        dc.a[1] = start - int(i);
+        dc.b[1] = 1;
+        int8_t differences[MAX_N];
+        memset(differences, 0, dc.size_n);
+        differences[0] = 1;
+        dc.GenD(1, 1, 1, differences);
+        printf("%3d\r", --countdown);
         fflush(stdout);
-        result.get();
-    }
+    });
     printf("\n");
     return 0;
 }
@@ -0,0 +1,207 @@
+/**
+ * @file backtrack.hpp
+ * @brief Backtracking search over sparse-set domains with trail-based undo
+ *
+ * Every variable has a domain of values 0 .. domain_size-1 kept in a
+ * DynamicSparseSet. Domains only shrink during the search, and each change
+ * pushes the variable and its previous domain size onto a trail. Undoing a
+ * level pops the trail and restores the sizes, so backtracking costs O(1)
+ * per change instead of copying the search state at every level.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ecgen/sparse_set.hpp>
+#include <utility>  // for pair
+#include <vector>
+
+namespace ecgen {
+
+    /**
+     * @brief Depth-first search with first-fail variable selection
+     *
+     * Example (8 queens, one variable per row):
+     * @code
+     *    auto solver = ecgen::Backtrack<>(8, 8);
+     *    auto count = 0;
+     *    solver.solve(
+     *        [](auto& s, int row) {  // prune the other rows
+     *            const auto col = s.value(row);
+     *            for (int r = 0; r != s.num_vars(); ++r) {
+     *                const auto dist = r > row ? r - row : row - r;
+     *                if (r != row && (!s.remove(r, col) || !s.remove(r, col + dist)
+     *                                 || !s.remove(r, col - dist))) {
+     *                    return false;
+     *                }
+     *            }
+     *            return true;
+     *        },
+     *        [&count](const auto&) { ++count; return true; });
+     *    // count == 92
+     * @endcode
+     *
+     * @tparam IndexT - The unsigned value type of the domains.
+     */
+    template <typename IndexT = std::uint16_t> class Backtrack {
+      public:
+        /**
+         * @brief Construct a new Backtrack object
+         *
+         * @param[in] num_vars - The number of variables.
+         * @param[in] domain_size - The number of values of every domain.
+         */
+        Backtrack(int num_vars, int domain_size)
+            : _domain_size{domain_size},
+              _decided(static_cast<std::size_t>(num_vars), false),
+              _values(static_cast<std::size_t>(num_vars) + 1) {
+            this->_domains.reserve(static_cast<std::size_t>(num_vars));
+            for (int i = 0; i != num_vars; ++i) {
+                this->_domains.emplace_back(static_cast<std::size_t>(domain_size));
+                this->_domains.back().fill();
+            }
+        }
+
+        auto num_vars() const noexcept -> int { return static_cast<int>(this->_domains.size()); }
+        auto domain_size() const noexcept -> int { return this->_domain_size; }
+
+        auto domain(int var) const -> const DynamicSparseSet<IndexT>& {
+            return this->_domains[static_cast<std::size_t>(var)];
+        }
+
+        auto is_assigned(int var) const -> bool { return this->domain(var).size() == 1; }
+
+        /// The value of an assigned variable
+        auto value(int var) const -> int { return int(*this->domain(var).begin()); }
+
+        /**
+         * @brief Remove a value from a domain (values outside the range are ignored)
+         *
+         * @param[in] var - The variable.
+         * @param[in] val - The value.
+         * @return false if the domain became empty.
+         */
+        auto remove(int var, int val) -> bool {
+            auto& domain = this->_domains[static_cast<std::size_t>(var)];
+            if (val < 0 || val >= this->_domain_size) {
+                return !domain.empty();
+            }
+            const auto old_size = domain.size();
+            if (domain.erase(static_cast<IndexT>(val))) {
+                this->_trail.emplace_back(var, old_size);
+            }
+            return !domain.empty();
+        }
+
+        /**
+         * @brief Reduce a domain to a single value
+         *
+         * @param[in] var - The variable.
+         * @param[in] val - The value.
+         * @return false if the value was not in the domain.
+         */
+        auto assign(int var, int val) -> bool {
+            auto& domain = this->_domains[static_cast<std::size_t>(var)];
+            if (val < 0 || val >= this->_domain_size
+                || !domain.contains(static_cast<IndexT>(val))) {
+                return false;
+            }
+            this->_trail.emplace_back(var, domain.size());
+            domain.keep_only(static_cast<IndexT>(val));
+            return true;
+        }
+
+        /// A point to return to with undo()
+        auto mark() const noexcept -> std::size_t { return this->_trail.size(); }
+
+        /**
+         * @brief Undo all domain changes made since mark() returned `mark`
+         *
+         * @param[in] mark - The trail position.
+         */
+        void undo(std::size_t mark) {
+            while (this->_trail.size() > mark) {
+                const auto [var, old_size] = this->_trail.back();
+                this->_trail.pop_back();
+                this->_domains[static_cast<std::size_t>(var)].restore(old_size);
+            }
+        }
+
+        /**
+         * @brief Enumerate all assignments consistent with the propagator
+         *
+         * At every node the undecided variable with the smallest domain is
+         * assigned each of its values in turn (variables whose domain was
+         * reduced to one value are decided first); then
+         * `propagate(*this, var)` may remove values from other domains and
+         * returns false on a conflict. When all variables are decided,
+         * `visit(*this)` is called; it returns false to stop the search.
+         *
+         * @tparam Propagate - callable as bool(Backtrack&, int var)
+         * @tparam Visit - callable as bool(const Backtrack&)
+         * @param[in] propagate - The propagator.
+         * @param[in] visit - The solution callback.
+         * @return false if the search was stopped by `visit`.
+         */
+        template <typename Propagate, typename Visit>
+        auto solve(Propagate&& propagate, Visit&& visit) -> bool {
+            return this->_search(0, propagate, visit);
+        }
+
+        auto nodes() const noexcept -> std::uint64_t { return this->_nodes; }
+        auto failures() const noexcept -> std::uint64_t { return this->_failures; }
+
+      private:
+        auto _select() const -> int {
+            auto best = -1;
+            auto best_size = std::size_t(-1);
+            for (int var = 0; var != this->num_vars(); ++var) {
+                const auto size = this->domain(var).size();
+                if (!this->_decided[static_cast<std::size_t>(var)] && size < best_size) {
+                    best = var;
+                    best_size = size;
+                }
+            }
+            return best;
+        }
+
+        template <typename Propagate, typename Visit>
+        auto _search(std::size_t depth, Propagate& propagate, Visit& visit) -> bool {
+            const auto var = this->_select();
+            if (var < 0) {
+                return visit(static_cast<const Backtrack&>(*this));
+            }
+            // the domain is reordered by the branches, so iterate over a copy
+            auto& values = this->_values[depth];
+            const auto& domain = this->domain(var);
+            values.assign(domain.begin(), domain.end());
+            auto go_on = true;
+            this->_decided[static_cast<std::size_t>(var)] = true;
+            for (const auto val : values) {
+                ++this->_nodes;
+                const auto saved = this->mark();
+                if (this->assign(var, int(val)) && propagate(*this, var)) {
+                    go_on = this->_search(depth + 1, propagate, visit);
+                } else {
+                    ++this->_failures;
+                }
+                this->undo(saved);
+                if (!go_on) {
+                    break;
+                }
+            }
+            this->_decided[static_cast<std::size_t>(var)] = false;
+            return go_on;
+        }
+
+        int _domain_size;
+        std::vector<DynamicSparseSet<IndexT>> _domains;
+        std::vector<bool> _decided;
+        std::vector<std::pair<int, std::size_t>> _trail;
+        std::vector<std::vector<IndexT>> _values;  ///< branch values per depth
+        std::uint64_t _nodes{0};
+        std::uint64_t _failures{0};
+    };
+
+}  // namespace ecgen
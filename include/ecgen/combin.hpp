@@ -5,6 +5,10 @@
 
 #pragma once
 
+#include <array>
+#include <bit>  // for popcount
+#include <cstddef>
+#include <cstdint>
 #include <py2cpp/gen.hpp>
 #include <py2cpp/recursive_gen.hpp>
 #include <type_traits>  // for integral_constant
@@ -68,6 +72,69 @@ namespace ecgen {
         }
     }
 
+    /**
+     * @brief A k-subset of 0 .. 64*W-1 as a bit mask, with the last change
+     *
+     * @tparam W - The number of 64-bit words.
+     */
+    template <std::size_t W = 1> struct CombMask {
+        std::array<std::uint64_t, W> words{};  ///< element i is bit i % 64 of words[i / 64]
+        int added{-1};                         ///< the element that joined (-1 at first)
+        int removed{-1};                       ///< the element that left (-1 at first)
+
+        auto test(int i) const noexcept -> bool {
+            return ((this->words[std::size_t(i) / 64] >> (i % 64)) & 1U) != 0;
+        }
+
+        /// The number of elements (always k)
+        auto count() const noexcept -> int {
+            auto total = 0;
+            for (const auto word : this->words) {
+                total += std::popcount(word);
+            }
+            return total;
+        }
+    };
+
+    /**
+     * @brief Generate all k-combinations of n elements as bit masks (revolving door)
+     *
+     * Same order as emk(n, k, lst) with lst = 1^k 0^(n-k), but the
+     * combination lives in W machine words: each step flips two bits, so
+     * intersections and popcounts against other masks need no container.
+     *
+     * Example:
+     * @code
+     *    for (const auto& comb : ecgen::emk_mask(30, 8)) {
+     *        if ((comb.words[0] & forbidden) == 0) { ... }
+     *    }
+     * @endcode
+     *
+     * @tparam W - The number of 64-bit words (n <= 64 * W).
+     * @param[in] n - The number of elements in the full set.
+     * @param[in] k - The number of elements to select.
+     * @returns A generator yielding the mask of each k-combination; yields
+     * nothing if n does not fit.
+     */
+    template <std::size_t W = 1> auto emk_mask(int n, int k) -> py::Generator<CombMask<W>&> {
+        if (n < 0 || std::size_t(n) > 64 * W || k < 0 || k > n) {
+            co_return;
+        }
+        auto comb = CombMask<W>{};
+        for (int i = 0; i != k; ++i) {
+            comb.words[std::size_t(i) / 64] |= std::uint64_t{1} << (i % 64);
+        }
+        co_yield comb;
+        for (const auto& [pos_x, pos_y] : emk_comb_gen(n, k)) {
+            const auto x_was_set = comb.test(pos_x);
+            comb.words[std::size_t(pos_x) / 64] ^= std::uint64_t{1} << (pos_x % 64);
+            comb.words[std::size_t(pos_y) / 64] ^= std::uint64_t{1} << (pos_y % 64);
+            comb.added = x_was_set ? pos_y : pos_x;
+            comb.removed = x_was_set ? pos_x : pos_y;
+            co_yield comb;
+        }
+    }
+
     /**
      * @brief Calculate binomial coefficient C(N, K) at compile time
      *
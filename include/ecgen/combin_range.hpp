@@ -0,0 +1,72 @@
+/**
+ * @file combin_range.hpp
+ * @brief Gray code for all subsets whose size lies in a range [k1, k2]
+ *
+ * Restricting the binary reflected Gray code to the subsets of [n] with
+ * k1 <= |S| <= k2 gives a list in which successive subsets differ by adding
+ * one element, removing one element, or swapping one element for another.
+ * For k1 = k2 = k this is the revolving door order of the k-combinations.
+ */
+
+#pragma once
+
+#include <py2cpp/gen.hpp>
+#include <utility>  // for pair
+
+namespace ecgen {
+
+    /**
+     * @brief Generate all subsets of size k1..k2 in minimal-change order
+     *
+     * The first subset is {0, 1, ..., k1-1}. Every following step is
+     * reported as a pair (removed, added), where -1 stands for "none":
+     *
+     * - (-1, y): add element y
+     * - (x, -1): remove element x
+     * - (x, y):  swap element x out and element y in
+     *
+     * Example visualization for n=3, k1=1, k2=2:
+     * @verbatim
+     *    {0} -> {0,1} -> {1} -> {1,2} -> {0,2} -> {2}
+     *       (-1,1)   (0,-1)  (-1,2)   (1,0)    (0,-1)
+     * @endverbatim
+     *
+     * @param[in] n - The number of elements in the full set.
+     * @param[in] k1 - The minimum subset size.
+     * @param[in] k2 - The maximum subset size.
+     * @returns A generator yielding (removed, added) pairs.
+     */
+    extern auto comb_range_gen(int n, int k1, int k2) -> py::Generator<std::pair<int, int>>;
+
+    /**
+     * @brief Generate all subsets of size k1..k2 as 0/1 containers
+     *
+     * @tparam Container - The type of container holding the 0/1 flags.
+     * @param[in] n - The number of elements in the full set.
+     * @param[in] k1 - The minimum subset size.
+     * @param[in] k2 - The maximum subset size.
+     * @return A generator that yields each subset, starting from
+     * {0, 1, ..., k1-1}.
+     */
+    template <typename Container> auto comb_range(int n, int k1, int k2)
+        -> py::Generator<Container&> {
+        if (n < 0 || k1 > k2 || k1 > n || k2 < 0) {
+            co_return;
+        }
+        auto lst = Container(static_cast<typename Container::size_type>(n), 0);
+        for (int idx = 0; idx < k1; ++idx) {
+            lst[static_cast<typename Container::size_type>(idx)] = 1;
+        }
+        co_yield lst;
+        for (const auto& [removed, added] : comb_range_gen(n, k1, k2)) {
+            if (removed >= 0) {
+                lst[static_cast<typename Container::size_type>(removed)] = 0;
+            }
+            if (added >= 0) {
+                lst[static_cast<typename Container::size_type>(added)] = 1;
+            }
+            co_yield lst;
+        }
+    }
+
+}  // namespace ecgen
@@ -0,0 +1,130 @@
+/**
+ * @file coollex.hpp
+ * @brief Combinations in cool-lex order, one bit mask per step
+ *
+ * In cool-lex order every k-subset of n elements (as a bit string b_0 b_1
+ * ... b_{n-1}, b_0 being bit 0) follows from the previous one by rotating a
+ * prefix: take the shortest prefix ending in 010 or 011, or the whole string
+ * if there is none, and shift it right by one place. On a machine word this
+ * is the loop-free successor of Ruskey and Williams:
+ * @verbatim
+ *    y = x & (x + 1)            clear the trailing ones
+ *    z = y ^ (y - 1)            ones up to the lowest one of y
+ *    x = x + (z & x) - max(((z + 1) & x) - 1, 0)
+ * @endverbatim
+ * and the enumeration ends when bit n becomes set.
+ *
+ * Successive subsets differ by one or two transpositions, so the order is
+ * not a revolving door; use emk_comb_gen() when that property matters.
+ *
+ * Reference:
+ * F. Ruskey, A. Williams. The coolest way to generate combinations.
+ * Discrete Mathematics 309 (2009), 5305-5320.
+ */
+
+#pragma once
+
+#include <bit>  // for countr_zero
+#include <cstddef>
+#include <cstdint>
+#include <ecgen/step_iterator.hpp>
+#include <iterator>  // for default_sentinel_t
+
+namespace ecgen {
+
+    /**
+     * @brief Loopless cool-lex generator of the k-subsets of 0 .. n-1 (n <= 63)
+     *
+     * Example (5 choose 3):
+     * @code
+     *    for (const auto& comb : ecgen::coollex_comb(5, 3)) {
+     *        auto mask = comb.mask();  // 00111, 01110, 01101, 01011, ...
+     *        comb.for_each_swap([](int out, int in) { ... });
+     *    }
+     * @endcode
+     */
+    class CoolLexComb {
+      public:
+        /// Visits the subsets; dereferences to the generator itself
+        using iterator = StepIterator<CoolLexComb>;
+
+        /**
+         * @brief Start at the subset {0, ..., k-1}
+         *
+         * @param[in] n - The number of elements (1 .. 63; otherwise nothing
+         * is generated).
+         * @param[in] k - The size of the subsets (0 .. n; otherwise nothing
+         * is generated).
+         */
+        CoolLexComb(int n, int k) {
+            if (n < 1 || n > 63 || k < 0 || k > n) {
+                return;
+            }
+            this->_mask = (std::uint64_t{1} << k) - 1;
+            this->_prev = this->_mask;
+            this->_limit = std::uint64_t{1} << n;
+            this->_single = k == 0;
+        }
+
+        /// The current subset: element i is bit i
+        auto mask() const noexcept -> std::uint64_t { return this->_mask; }
+
+        /// The elements removed by the last step
+        auto removed() const noexcept -> std::uint64_t { return this->_prev & ~this->_mask; }
+
+        /// Whether there is nothing to generate
+        auto empty() const noexcept -> bool { return this->_limit == 0; }
+
+        /// The elements added by the last step
+        auto added() const noexcept -> std::uint64_t { return this->_mask & ~this->_prev; }
+
+        /**
+         * @brief Advance to the next subset
+         *
+         * @return false after the last subset (mask() is then meaningless).
+         */
+        auto next() noexcept -> bool {
+            const auto x = this->_mask;
+            const auto y = x & (x + 1);
+            const auto z = y ^ (y - 1);
+            const auto w = (z + 1) & x;
+            this->_prev = x;
+            this->_mask = x + (z & x) - (w - std::uint64_t{w != 0});
+            return this->_mask < this->_limit && !this->_single;
+        }
+
+        /**
+         * @brief The last step as transpositions
+         *
+         * @param[in] visit - called as visit(int out, int in) once or twice.
+         */
+        template <typename Visit> void for_each_swap(Visit&& visit) const {
+            auto removed = this->removed();
+            auto added = this->added();
+            while (removed != 0) {
+                visit(std::countr_zero(removed), std::countr_zero(added));
+                removed &= removed - 1;
+                added &= added - 1;
+            }
+        }
+
+        auto begin() -> iterator { return iterator{this}; }
+        auto end() const noexcept -> std::default_sentinel_t { return {}; }
+
+      private:
+        std::uint64_t _mask{0};
+        std::uint64_t _prev{0};   ///< the subset before the last step
+        std::uint64_t _limit{0};  ///< bit n, or 0 if nothing is generated
+        bool _single{false};      ///< k == 0: only the empty set
+    };
+
+    /**
+     * @brief Generate all k-combinations of n elements in cool-lex order
+     *
+     * @param[in] n - The number of elements (1 .. 63).
+     * @param[in] k - The size of the combinations.
+     * @return A range over the subsets, see CoolLexComb.
+     */
+    inline auto coollex_comb(int n, int k) -> CoolLexComb { return CoolLexComb(n, k); }
+
+}  // namespace ecgen
@@ -0,0 +1,96 @@
+/**
+ * @file de_bruijn.hpp
+ * @brief Streaming de Bruijn sequences with bounded memory and seeking
+ *
+ * The lexicographically least de Bruijn sequence B(k, n) is the
+ * concatenation, in lexicographic order, of the Lyndon words over
+ * {0, ..., k-1} whose length divides n (Fredricksen, Kessler, Maiorana).
+ * The Lyndon words come from the successor rule for prenecklaces
+ * @verbatim
+ *    j = last position with a[j] < k-1;  a[j]++;  a[i] = a[i-j] for i > j
+ * @endverbatim
+ * which takes constant amortized time per symbol and keeps only the
+ * current word, so a sequence of length k^n is streamed in O(n) memory.
+ *
+ * Example B(2, 3):
+ * @verbatim
+ *    0 | 001 | 011 | 1   ->   00010111
+ * @endverbatim
+ *
+ * The sequence is cyclic: every word of length n occurs once as a window
+ * when the first n-1 symbols are appended at the end.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace ecgen {
+
+    /**
+     * @brief Chunked reader of the de Bruijn sequence B(k, n)
+     *
+     * Example (write B(2, 32), 4 GiB of symbols, in 1 MiB chunks):
+     * @code
+     *    auto stream = ecgen::DeBruijnStream(2, 32);
+     *    auto chunk = std::vector<std::uint8_t>(1 << 20);
+     *    while (auto count = stream.read(chunk)) {
+     *        std::fwrite(chunk.data(), 1, count, file);
+     *    }
+     * @endcode
+     */
+    class DeBruijnStream {
+      public:
+        /**
+         * @brief Construct a new De Bruijn Stream object at offset 0
+         *
+         * @param[in] k - The alphabet size (2 .. 256).
+         * @param[in] n - The window length (at least 1, with k^n < 2^64);
+         * otherwise the stream is empty.
+         */
+        DeBruijnStream(int k, int n);
+
+        /// The length k^n of the sequence (0 for invalid arguments)
+        auto length() const noexcept -> std::uint64_t { return this->_length; }
+
+        /// The offset of the next symbol to be read
+        auto position() const noexcept -> std::uint64_t { return this->_pos; }
+
+        /**
+         * @brief Read the next symbols
+         *
+         * @param[out] out - The buffer to fill.
+         * @return The number of symbols written; less than out.size() only
+         * at the end of the sequence.
+         */
+        auto read(std::span<std::uint8_t> out) -> std::size_t;
+
+        /**
+         * @brief Move to an offset
+         *
+         * Finds the Lyndon word covering `pos` by counting, symbol by
+         * symbol, the words of length n whose necklace is smaller. The time
+         * does not depend on `pos` (O(n^5 log k) at worst).
+         *
+         * @param[in] pos - The offset (0 .. length()).
+         * @return false if `pos` is past the end (the position is unchanged).
+         */
+        auto seek(std::uint64_t pos) -> bool;
+
+      private:
+        auto _advance() -> bool;
+        auto _rank(const std::vector<std::uint8_t>& word) const -> std::uint64_t;
+
+        int _k;
+        int _n;
+        std::uint64_t _length{0};
+        std::uint64_t _pos{0};
+        std::vector<std::uint8_t> _a;  ///< a[1..n]: the current prenecklace
+        int _p{1};                     ///< the length of its longest Lyndon prefix
+        int _offset{0};                ///< symbols of a[1..p] already read
+    };
+
+}  // namespace ecgen
@@ -0,0 +1,331 @@
+/**
+ * @file delta_stream.hpp
+ * @brief Compact on-disk format for generated sequences
+ *
+ * Every ecgen generator changes its object by one small move per step, so a
+ * sequence is stored as its moves rather than its objects. The moves are
+ * bit-packed with just enough bits for a position, and the sequence is cut
+ * into blocks of a fixed number of steps. Each block starts with a snapshot
+ * of the object at its first rank, so any block can be replayed on its own,
+ * and an index of block offsets at the end of the file makes seeking O(1).
+ *
+ * File layout (little endian on every host):
+ * @verbatim
+ *    header      64 bytes: "ECGDELTA", version, move kind, object size,
+ *                bits per field, block size, steps, blocks, index offset
+ *    block 0     snapshot fields, then the moves, padded to 8 bytes
+ *    block 1     ...
+ *    index       one 64-bit byte offset per block
+ * @endverbatim
+ *
+ * With 5-bit fields, 10^10 steps of a Gray code of length 30 take about
+ * 6 GB.
+ */
+
+#pragma once
+
+#include <algorithm>  // for min
+#include <bit>        // for endian
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <ecgen/mapped_file.hpp>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>  // for move
+#include <vector>
+
+namespace ecgen {
+
+    /**
+     * @brief Convert between host and little-endian byte order
+     *
+     * The identity on little-endian hosts; applying it twice gives the value
+     * back, so it serves both for storing and for loading.
+     */
+    template <typename UInt> constexpr auto little_endian(UInt value) noexcept -> UInt {
+        if constexpr (std::endian::native == std::endian::little) {
+            return value;
+        } else {
+            auto swapped = UInt{0};
+            for (auto i = 0U; i != sizeof value; ++i) {
+                swapped = static_cast<UInt>(swapped << 8) | static_cast<UInt>(value & 0xFFU);
+                value = static_cast<UInt>(value >> 8);
+            }
+            return swapped;
+        }
+    }
+
+    /// How a stored move changes the object
+    enum class DeltaMove : std::uint32_t {
+        swap,        ///< (x, y): exchange entries x and y (emk_comb_gen)
+        swap_first,  ///< (x): exchange entries 0 and x (ehr_gen)
+        swap_next,   ///< (x): exchange entries x and x + 1 (sjt_gen)
+        flip,        ///< (x): entry x becomes 1 - entry x (brgc_gen)
+        assign,      ///< (x, y): entry x becomes y (set_partition_gen, x from 0)
+    };
+
+    /// The number of fields of a move: 1 or 2
+    constexpr auto delta_move_arity(DeltaMove move) noexcept -> unsigned {
+        return move == DeltaMove::swap || move == DeltaMove::assign ? 2U : 1U;
+    }
+
+    /**
+     * @brief Apply one move to an object
+     *
+     * @param[in] move - The kind of move.
+     * @param[in,out] object - The object.
+     * @param[in] x - The first field.
+     * @param[in] y - The second field (ignored by one-field moves).
+     */
+    inline void apply_delta_move(DeltaMove move, std::vector<int>& object, int x, int y) {
+        const auto i = static_cast<std::size_t>(x);
+        switch (move) {
+            case DeltaMove::swap:
+                std::swap(object[i], object[static_cast<std::size_t>(y)]);
+                break;
+            case DeltaMove::swap_first:
+                std::swap(object[0], object[i]);
+                break;
+            case DeltaMove::swap_next:
+                std::swap(object[i], object[i + 1]);
+                break;
+            case DeltaMove::flip:
+                object[i] = 1 - object[i];
+                break;
+            case DeltaMove::assign:
+                object[i] = y;
+                break;
+        }
+    }
+
+    /**
+     * @brief Writes a delta stream file step by step
+     *
+     * Example:
+     * @code
+     *    auto writer = ecgen::DeltaStreamWriter::create(
+     *        "comb.ecd", ecgen::DeltaMove::swap, {1, 1, 1, 0, 0, 0});
+     *    for (auto [x, y] : ecgen::emk_comb_gen(6, 3)) {
+     *        writer->push(x, y);
+     *    }
+     *    writer->close();
+     * @endcode
+     */
+    class DeltaStreamWriter {
+      public:
+        /**
+         * @brief Start a new file
+         *
+         * Fields get bit_width(max(size - 1, largest entry)) bits, so every
+         * position and every entry of the initial object fits.
+         *
+         * @param[in] path - The file (replaced if it exists).
+         * @param[in] move - The kind of the moves.
+         * @param[in] initial - The object at rank 0 (entries >= 0).
+         * @param[in] block_size - The number of steps per block.
+         * @return std::nullopt if the file cannot be created or the
+         * arguments are invalid.
+         */
+        static auto create(const std::string& path, DeltaMove move, std::vector<int> initial,
+                           std::uint32_t block_size = 1U << 16)
+            -> std::optional<DeltaStreamWriter>;
+
+        DeltaStreamWriter(DeltaStreamWriter&& other) noexcept;
+        auto operator=(DeltaStreamWriter&&) -> DeltaStreamWriter& = delete;
+        DeltaStreamWriter(const DeltaStreamWriter&) = delete;
+        auto operator=(const DeltaStreamWriter&) -> DeltaStreamWriter& = delete;
+        ~DeltaStreamWriter();
+
+        /**
+         * @brief Append one step
+         *
+         * @param[in] x - The first field.
+         * @param[in] y - The second field (two-field moves only).
+         * @return false if a field is out of range; nothing is written then.
+         */
+        auto push(int x, int y = 0) -> bool;
+
+        /**
+         * @brief Write the index and the header and close the file
+         *
+         * Called by the destructor if needed.
+         *
+         * @return false on an I/O error.
+         */
+        auto close() -> bool;
+
+        auto num_steps() const noexcept -> std::uint64_t { return this->_num_steps; }
+
+      private:
+        DeltaStreamWriter(std::FILE* file, DeltaMove move, std::vector<int> initial,
+                          unsigned bits, std::uint32_t block_size);
+
+        void _put(std::uint32_t value);
+        void _start_block();
+        void _flush_word();
+        void _flush_buffer();
+
+        std::FILE* _file;
+        DeltaMove _move;
+        std::vector<int> _object;  ///< the object after the last step
+        unsigned _bits;
+        std::uint32_t _block_size;
+        std::uint64_t _num_steps{0};
+        std::uint64_t _offset;  ///< bytes written or buffered so far
+        std::vector<std::uint64_t> _index;
+        std::vector<std::uint64_t> _buffer;
+        std::uint64_t _word{0};
+        unsigned _used{0};  ///< bits used in _word
+        bool _ok{true};
+    };
+
+    /**
+     * @brief Random access to a delta stream file through a memory mapping
+     *
+     * The object at rank r is block r / block_size() replayed up to step
+     * r % block_size(). Readers in several processes share the mapped pages.
+     */
+    class DeltaStreamReader {
+      public:
+        /**
+         * @brief Open a file written by DeltaStreamWriter
+         *
+         * @param[in] path - The file.
+         * @return std::nullopt if the file is missing, of another version,
+         * or inconsistent.
+         */
+        static auto open(const std::string& path) -> std::optional<DeltaStreamReader>;
+
+        auto move() const noexcept -> DeltaMove { return this->_move; }
+        auto object_size() const noexcept -> std::size_t { return this->_object_size; }
+        auto block_size() const noexcept -> std::uint32_t { return this->_block_size; }
+        auto num_steps() const noexcept -> std::uint64_t { return this->_num_steps; }
+        auto num_blocks() const noexcept -> std::uint64_t { return this->_num_blocks; }
+
+        /// The number of steps stored in a block
+        auto block_steps(std::uint64_t block) const noexcept -> std::uint64_t {
+            const auto first = block * this->_block_size;
+            return std::min<std::uint64_t>(this->_block_size, this->_num_steps - first);
+        }
+
+        /// The object at the first rank of a block
+        auto snapshot(std::uint64_t block) const -> std::vector<int>;
+
+        /// The object at a rank (0 .. num_steps())
+        auto object_at(std::uint64_t rank) const -> std::vector<int>;
+
+        /**
+         * @brief Decode the moves of a block
+         *
+         * @param[in] block - The block.
+         * @param[in] visit - callable as visit(int x, int y); y is 0 for
+         * one-field moves.
+         */
+        template <typename Visit> void for_each_move(std::uint64_t block, Visit&& visit) const {
+            const auto arity = delta_move_arity(this->_move);
+            auto bit = this->_block_bit(block) + this->_object_size * this->_bits;
+            const auto steps = this->block_steps(block);
+            for (auto i = std::uint64_t{0}; i != steps; ++i) {
+                const auto x = this->_read(bit);
+                bit += this->_bits;
+                auto y = 0U;
+                if (arity == 2) {
+                    y = this->_read(bit);
+                    bit += this->_bits;
+                }
+                visit(static_cast<int>(x), static_cast<int>(y));
+            }
+        }
+
+        /**
+         * @brief Visit the objects whose ranks fall in a block
+         *
+         * These are the snapshot and the objects after each step, except
+         * that the last step of a block leads to the next block's snapshot.
+         *
+         * @param[in] block - The block.
+         * @param[in] visit - callable as visit(const std::vector<int>&)
+         */
+        template <typename Visit> void replay(std::uint64_t block, Visit&& visit) const {
+            auto object = this->snapshot(block);
+            visit(static_cast<const std::vector<int>&>(object));
+            const auto last = block + 1 == this->_num_blocks ? this->block_steps(block)
+                                                              : this->block_steps(block) - 1;
+            auto step = std::uint64_t{0};
+            this->for_each_move(block, [&](int x, int y) {
+                if (step++ < last) {
+                    apply_delta_move(this->_move, object, x, y);
+                    visit(static_cast<const std::vector<int>&>(object));
+                }
+            });
+        }
+
+      private:
+        explicit DeltaStreamReader(MappedFile file) : _file{std::move(file)} {}
+
+        auto _block_bit(std::uint64_t block) const -> std::uint64_t {
+            auto offset = std::uint64_t{0};
+            std::memcpy(&offset, this->_file.data() + this->_index_offset + 8 * block, 8);
+            return little_endian(offset) * 8;
+        }
+
+        /// The field starting at a bit position (fields never exceed 32 bits)
+        auto _read(std::uint64_t bit) const -> std::uint32_t {
+            const auto* bytes = this->_file.data() + (bit / 64) * 8;
+            const auto shift = static_cast<unsigned>(bit % 64);
+            auto lo = std::uint64_t{0};
+            std::memcpy(&lo, bytes, 8);
+            auto value = little_endian(lo) >> shift;
+            if (shift + this->_bits > 64) {
+                auto hi = std::uint64_t{0};
+                std::memcpy(&hi, bytes + 8, 8);
+                value |= little_endian(hi) << (64 - shift);
+            }
+            return static_cast<std::uint32_t>(value & ((std::uint64_t{1} << this->_bits) - 1));
+        }
+
+        MappedFile _file;
+        DeltaMove _move{DeltaMove::swap};
+        std::size_t _object_size{0};
+        unsigned _bits{0};
+        std::uint32_t _block_size{0};
+        std::uint64_t _num_steps{0};
+        std::uint64_t _num_blocks{0};
+        std::uint64_t _index_offset{0};
+    };
+
+    /**
+     * @brief Write a whole generator to a delta stream file
+     *
+     * @param[in] path - The file.
+     * @param[in] move - The kind of the moves.
+     * @param[in] initial - The object at rank 0.
+     * @param[in] gen - A generator of int or std::pair<int, int> moves.
+     * @param[in] block_size - The number of steps per block.
+     * @return false if the file could not be written.
+     */
+    template <typename Gen>
+    auto write_delta_stream(const std::string& path, DeltaMove move, std::vector<int> initial,
+                            Gen&& gen, std::uint32_t block_size = 1U << 16) -> bool {
+        auto writer = DeltaStreamWriter::create(path, move, std::move(initial), block_size);
+        if (!writer) {
+            return false;
+        }
+        for (const auto& step : gen) {
+            auto ok = true;
+            if constexpr (std::is_integral_v<std::decay_t<decltype(step)>>) {
+                ok = writer->push(step);
+            } else {
+                ok = writer->push(step.first, step.second);
+            }
+            if (!ok) {
+                return false;
+            }
+        }
+        return writer->close();
+    }
+
+}  // namespace ecgen
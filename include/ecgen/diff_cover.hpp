@@ -0,0 +1,212 @@
+/**
+ * @file diff_cover.hpp
+ * @brief Parallel search for cyclic difference covers
+ *
+ * A difference cover of Z_n is a set D of d residues such that every
+ * r = 1, ..., n-1 can be written as x - y (mod n) with x, y in D. Since a
+ * rotation of a difference cover is again a difference cover, the search
+ * enumerates binary necklaces of length n and density d with Sawada's
+ * fixed-density algorithm, pruning prefixes that can no longer cover all
+ * differences.
+ *
+ * The candidate sets are written as a[1] < a[2] < ... < a[d] = n, where
+ * a[i] is the position of the i-th one of the necklace; a[d] = n stands for
+ * the residue 0.
+ *
+ * Reference:
+ * Joe Sawada. Generating bracelets with fixed content. Theoretical Computer
+ * Science 475 (2013), 103-112 (fixed-density necklaces, "necklace.c").
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <utility>  // for move
+#include <vector>
+
+namespace ecgen {
+
+    class WorkStealingPool;
+
+    /**
+     * @brief Which transformations identify two difference covers
+     *
+     * Rotations x -> x + c are always factored out by the necklace
+     * enumeration. `dihedral` also identifies reflections x -> -x, and
+     * `affine` identifies all images x -> u x + c with u a unit mod n.
+     */
+    enum class DiffCoverSymmetry { rotation, dihedral, affine };
+
+    /**
+     * @brief Per-depth counters of a difference-cover search
+     *
+     * Index t counts the nodes whose last placed element is a[t].
+     */
+    struct DiffCoverStats {
+        std::vector<std::uint64_t> nodes;   ///< nodes visited
+        std::vector<std::uint64_t> pruned;  ///< nodes cut by a bound
+        std::uint64_t covers{0};            ///< complete covers found
+        std::uint64_t non_canonical{0};     ///< covers rejected by the symmetry check
+    };
+
+    /**
+     * @brief Search engine for cyclic difference covers
+     *
+     * The search tree is split into subtrees at a depth chosen from the
+     * number of workers, and the subtrees are scheduled on a
+     * WorkStealingPool, so large branches do not end up on a single thread.
+     * All workers observe a shared stop flag, which is raised when the first
+     * cover is found (find_first) or when cancel() is called from any thread.
+     *
+     * A node a[0..t] is pruned when either built-in bound fails:
+     *  - the elements a[t+1], ..., a[d-1] still to be placed add at most
+     *    (t+1) + ... + (d-1) new differences;
+     *  - a difference larger than n - 2 - a[t] cannot occur between two of
+     *    them, so each one covers at most t+1 of those.
+     *
+     * Further bounds can be plugged in with set_bound().
+     *
+     * Example:
+     * @code
+     *    auto search = ecgen::DiffCoverSearch(13, 4);
+     *    if (auto cover = search.find_first()) {
+     *        // *cover == {a[1], ..., a[4]} with a[4] == 13
+     *    }
+     * @endcode
+     */
+    class DiffCoverSearch {
+      public:
+        /**
+         * @brief Construct a new Diff Cover Search object
+         *
+         * @param[in] n - The modulus.
+         * @param[in] d - The size of the cover.
+         * @param[in] threshold - The depth from which the coverage bound is
+         * checked (the bound is always checked on complete sets).
+         */
+        DiffCoverSearch(int n, int d, int threshold = 1);
+
+        /**
+         * @brief Additional pruning test
+         *
+         * Called as bound(t, a, covered) for every node that passes the
+         * built-in bounds, where a[0..t] is the prefix (a[0] = 0) and
+         * `covered` the number of differences in 1..n/2 covered by it.
+         * Returning false prunes the subtree. The bound may be called from
+         * several threads at once.
+         */
+        using Bound = std::function<bool(int t, const std::vector<int>& a, int covered)>;
+
+        /**
+         * @brief Set the symmetry group factored out of the results
+         *
+         * Covers that are not the canonical representative of their orbit
+         * are rejected when they are reached.
+         *
+         * @param[in] symmetry - The symmetry group (default rotation).
+         */
+        void set_symmetry(DiffCoverSymmetry symmetry) noexcept { this->_symmetry = symmetry; }
+
+        /**
+         * @brief Install an additional pruning test (see Bound)
+         *
+         * @param[in] bound - The test, or an empty function to remove it.
+         */
+        void set_bound(Bound bound) { this->_bound = std::move(bound); }
+
+        /**
+         * @brief Install a minimum coverage per depth
+         *
+         * Prunes a node a[0..t] when it covers fewer than min_covered[t]
+         * differences (depths beyond the table are not checked).
+         *
+         * @param[in] min_covered - The table.
+         */
+        void set_min_coverage(std::vector<int> min_covered);
+
+        /**
+         * @brief Counters of the last search
+         *
+         * @return const DiffCoverStats&
+         */
+        auto stats() const noexcept -> const DiffCoverStats& { return this->_stats; }
+
+        /**
+         * @brief Find one difference cover
+         *
+         * @param[in] num_workers - The number of threads (0 means all cores).
+         * @return The cover a[1..d], or std::nullopt if none exists or the
+         * search was cancelled.
+         */
+        auto find_first(unsigned num_workers = 0) -> std::optional<std::vector<int>>;
+
+        /**
+         * @brief Find one difference cover on a shared pool
+         *
+         * @param[in] pool - The pool to run on.
+         * @return The cover a[1..d], or std::nullopt.
+         */
+        auto find_first(WorkStealingPool& pool) -> std::optional<std::vector<int>>;
+
+        /**
+         * @brief Find all difference covers, one per rotation class
+         *
+         * @param[in] num_workers - The number of threads (0 means all cores).
+         * @return The covers a[1..d] in lexicographic order (incomplete if the
+         * search was cancelled).
+         */
+        auto find_all(unsigned num_workers = 0) -> std::vector<std::vector<int>>;
+
+        /**
+         * @brief Find all difference covers on a shared pool
+         *
+         * @param[in] pool - The pool to run on.
+         * @return The covers a[1..d] in lexicographic order.
+         */
+        auto find_all(WorkStealingPool& pool) -> std::vector<std::vector<int>>;
+
+        /**
+         * @brief Ask a running search to stop as soon as possible
+         *
+         * Safe to call from any thread, including from another search worker.
+         * A call made before a search starts stops that search at once; the
+         * request is cleared when a search returns.
+         */
+        void cancel() noexcept { this->_stop.store(true, std::memory_order_relaxed); }
+
+        /**
+         * @brief Check whether a set of residues is a difference cover of Z_n
+         *
+         * @param[in] n - The modulus.
+         * @param[in] set - The residues (taken mod n).
+         * @return true if every nonzero residue is a difference of two
+         * elements of the set.
+         */
+        static auto is_difference_cover(int n, const std::vector<int>& set) -> bool;
+
+      private:
+        struct Task;
+        class Worker;
+
+        enum class Mode { first, all };
+
+        auto _run(Mode mode, WorkStealingPool& pool) -> std::vector<std::vector<int>>;
+        auto _walk(Mode mode, WorkStealingPool& pool) -> std::vector<std::vector<int>>;
+
+        int _n;
+        int _d;
+        int _threshold;
+        Mode _mode{Mode::first};
+        DiffCoverSymmetry _symmetry{DiffCoverSymmetry::rotation};
+        Bound _bound;
+        DiffCoverStats _stats;
+        std::atomic<bool> _stop{false};
+        std::mutex _mutex;
+        std::vector<std::vector<int>> _found;
+    };
+
+}  // namespace ecgen
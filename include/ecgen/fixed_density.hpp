@@ -0,0 +1,221 @@
+/**
+ * @file fixed_density.hpp
+ * @brief Fixed-density necklaces and Lyndon words with prefix pruning
+ *
+ * A k-ary necklace of length n with density d has exactly d nonzero
+ * symbols. Sawada's algorithm (GenD in necklace.c) stores only those: the
+ * i-th nonzero symbol b[i] sits at position a[i], 1 <= a[1] < ... < a[d] = n,
+ * so the walk costs O(d) space and constant amortized time per necklace
+ * rather than per n-ary word. For example, with n = 6, d = 3, k = 2:
+ * @verbatim
+ *    0 0 1 0 1 1   a = 3 5 6
+ *    0 1 0 1 0 1   a = 2 4 6
+ * @endverbatim
+ *
+ * The prefixes a[1..t] are built in decreasing order of a[1] and can be
+ * rejected by an accept callback. DiffCoverSearch prunes the same tree
+ * (binary case) with its coverage bounds.
+ *
+ * Reference:
+ * J. Sawada. A fast algorithm to generate necklaces with fixed content.
+ * Theoretical Computer Science 301 (2003), 477-489.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <ecgen/necklace.hpp>  // for NecklaceKind
+#include <span>
+#include <vector>
+
+namespace ecgen {
+
+    /**
+     * @brief Depth-first fixed-density necklace walk with a pruning hook
+     *
+     * Example (binary necklaces of length 13 with 4 ones that cover all
+     * differences mod 13):
+     * @code
+     *    auto gen = ecgen::FixedDensityNecklaces(13, 4);
+     *    gen.run(
+     *        [](std::span<const int> a, std::span<const int>) { return true; },
+     *        [](std::span<const int> a, std::span<const int>) {
+     *            // a = {a[1], ..., a[4]} with a[4] == 13
+     *            return true;
+     *        });
+     * @endcode
+     */
+    class FixedDensityNecklaces {
+      public:
+        /**
+         * @brief Construct a new Fixed Density Necklaces object
+         *
+         * @param[in] n - The word length (at least 1).
+         * @param[in] d - The number of nonzero symbols (0 .. n).
+         * @param[in] k - The alphabet size, symbols 0 .. k-1 (at least 2,
+         * or 1 with d == 0).
+         * @param[in] kind - NecklaceKind::necklace or NecklaceKind::lyndon;
+         * prenecklaces are not generated.
+         */
+        FixedDensityNecklaces(int n, int d, int k = 2,
+                              NecklaceKind kind = NecklaceKind::necklace)
+            : _n{n}, _d{d}, _k{k}, _kind{kind} {}
+
+        /**
+         * @brief Enumerate the words whose every prefix is accepted
+         *
+         * For t = 1 .. d-1, after a[t] and b[t] are chosen,
+         * `accept(positions, symbols)` is called with the views a[1..t] and
+         * b[1..t]; false skips every word extending the prefix. Complete
+         * words go to `visit(positions, symbols)` with a[1..d] (a[d] == n)
+         * and b[1..d], which returns false to stop the walk. The views are
+         * valid during the call only.
+         *
+         * @tparam Accept - callable as bool(std::span<const int>, std::span<const int>)
+         * @tparam Visit - callable as bool(std::span<const int>, std::span<const int>)
+         * @return false if the walk was stopped by `visit`.
+         */
+        template <typename Accept, typename Visit>
+        auto run(Accept&& accept, Visit&& visit) -> bool {
+            this->_nodes = this->_pruned = this->_leaves = 0;
+            const auto d = this->_d;
+            if (this->_n < 1 || d < 0 || d > this->_n || this->_k < (d == 0 ? 1 : 2)
+                || this->_kind == NecklaceKind::prenecklace) {
+                return true;
+            }
+            this->_a.assign(static_cast<std::size_t>(d) + 1, 0);
+            this->_b.assign(static_cast<std::size_t>(d) + 1, 0);
+            if (d == 0) {  // 0^n
+                if (this->_kind == NecklaceKind::lyndon && this->_n != 1) {
+                    return true;
+                }
+                return this->_emit(visit);
+            }
+            this->_a[static_cast<std::size_t>(d)] = this->_n;
+            if (d == 1) {  // 0^(n-1) s, always aperiodic
+                for (auto symbol = 1; symbol < this->_k; ++symbol) {
+                    this->_b[1] = symbol;
+                    if (!this->_emit(visit)) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+            for (auto j = this->_n - d + 1; j >= (this->_n - 1) / d + 1; --j) {
+                this->_a[1] = j;
+                for (auto symbol = 1; symbol < this->_k; ++symbol) {
+                    this->_b[1] = symbol;
+                    if (this->_decide(1, accept) && !this->_gen(1, 1, accept, visit)) {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+
+        /// The number of accepted prefixes
+        auto nodes() const noexcept -> std::uint64_t { return this->_nodes; }
+
+        /// The number of rejected prefixes (each skips a whole subtree)
+        auto pruned() const noexcept -> std::uint64_t { return this->_pruned; }
+
+        /// The number of visited words
+        auto leaves() const noexcept -> std::uint64_t { return this->_leaves; }
+
+      private:
+        /// Extend a[1..t] (period p, counted in nonzero symbols) to d symbols
+        template <typename Accept, typename Visit>
+        auto _gen(int t, int p, Accept& accept, Visit& visit) -> bool {
+            if (t >= this->_d - 1) {
+                return this->_leaf(p, visit);
+            }
+            auto& a = this->_a;
+            auto& b = this->_b;
+            const auto next = static_cast<std::size_t>(t + 1);
+            auto tail = this->_n - (this->_d - t) + 1;
+            const auto back = static_cast<std::size_t>(t - p + 1);  // a[t+1] repeats a[back]
+            const auto max = a[back] + a[static_cast<std::size_t>(p)];
+            if (max <= tail) {
+                a[next] = max;
+                b[next] = b[back];
+                if (this->_decide(t + 1, accept) && !this->_gen(t + 1, p, accept, visit)) {
+                    return false;
+                }
+                for (auto symbol = b[next] + 1; symbol < this->_k; ++symbol) {
+                    b[next] = symbol;
+                    if (this->_decide(t + 1, accept) && !this->_gen(t + 1, t + 1, accept, visit)) {
+                        return false;
+                    }
+                }
+                tail = max - 1;
+            }
+            for (auto j = tail; j >= a[static_cast<std::size_t>(t)] + 1; --j) {
+                a[next] = j;
+                for (auto symbol = 1; symbol < this->_k; ++symbol) {
+                    b[next] = symbol;
+                    if (this->_decide(t + 1, accept) && !this->_gen(t + 1, t + 1, accept, visit)) {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+
+        /// Choose the last symbol b[d] of a complete prenecklace (PrintD)
+        template <typename Visit> auto _leaf(int p, Visit& visit) -> bool {
+            const auto& a = this->_a;
+            const auto d = this->_d;
+            const auto next = (d / p) * a[static_cast<std::size_t>(p)]
+                              + a[static_cast<std::size_t>(d % p)];
+            if (next < this->_n) {
+                return true;
+            }
+            auto min = 1;
+            if (next == this->_n && d % p != 0) {
+                min = this->_b[static_cast<std::size_t>(d % p)] + 1;
+                p = d;
+            } else if (next == this->_n) {
+                min = this->_b[static_cast<std::size_t>(p)];
+            }
+            auto& last = this->_b[static_cast<std::size_t>(d)];
+            for (last = min; last < this->_k; ++last) {
+                const auto period = a[static_cast<std::size_t>(p)];
+                const auto periodic = this->_n % period == 0 && period != this->_n;
+                if (!(this->_kind == NecklaceKind::lyndon && periodic) && !this->_emit(visit)) {
+                    return false;
+                }
+                p = d;
+            }
+            return true;
+        }
+
+        template <typename Accept> auto _decide(int t, Accept& accept) -> bool {
+            const auto len = static_cast<std::size_t>(t);
+            if (accept(std::span<const int>(this->_a.data() + 1, len),
+                       std::span<const int>(this->_b.data() + 1, len))) {
+                ++this->_nodes;
+                return true;
+            }
+            ++this->_pruned;
+            return false;
+        }
+
+        template <typename Visit> auto _emit(Visit& visit) -> bool {
+            ++this->_leaves;
+            const auto len = static_cast<std::size_t>(this->_d);
+            return visit(std::span<const int>(this->_a.data() + 1, len),
+                         std::span<const int>(this->_b.data() + 1, len));
+        }
+
+        int _n;
+        int _d;
+        int _k;
+        NecklaceKind _kind;
+        std::vector<int> _a;  ///< a[1..d]: positions of the nonzero symbols, a[0] = 0
+        std::vector<int> _b;  ///< b[1..d]: the nonzero symbols
+        std::uint64_t _nodes{0};
+        std::uint64_t _pruned{0};
+        std::uint64_t _leaves{0};
+    };
+
+}  // namespace ecgen
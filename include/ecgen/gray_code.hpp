@@ -7,6 +7,8 @@
 
 #include <py2cpp/gen.hpp>
 #include <py2cpp/recursive_gen.hpp>
+#include <utility>  // for pair
+#include <vector>
 
 namespace ecgen {
     /**
@@ -65,4 +67,54 @@ namespace ecgen {
             co_yield lst;
         }
     }
+
+    /**
+     * @brief Generate the reflected mixed-radix Gray code (loopless)
+     *
+     * Enumerates all tuples (a_0, ..., a_{n-1}) with 0 <= a_j < radices[j] such
+     * that successive tuples differ in exactly one coordinate, by +1 or -1.
+     * Coordinate 0 changes most often. Each step takes constant time (Knuth,
+     * TAOCP Vol. 4A, Algorithm 7.2.1.1H). Coordinates with radix 1 never
+     * change.
+     *
+     * Example visualization for radices (3, 2):
+     * @verbatim
+     *    (0,0) -> (1,0) -> (2,0) -> (2,1) -> (1,1) -> (0,1)
+     *    yields: (0,+1) (0,+1) (1,+1) (0,-1) (0,-1)
+     * @endverbatim
+     *
+     * @param[in] radices - The base of each coordinate (all >= 1).
+     * @returns A generator that yields (coordinate, delta) pairs, starting
+     * from the all-zero tuple.
+     */
+    extern auto mixed_radix_gray_gen(std::vector<int> radices)
+        -> py::Generator<std::pair<int, int>>;
+
+    /**
+     * @brief Generate all mixed-radix tuples in reflected Gray code order
+     *
+     * Example visualization for radices (3, 2):
+     * @verbatim
+     *    [0,0] [1,0] [2,0] [2,1] [1,1] [0,1]
+     * @endverbatim
+     *
+     * @tparam Container - The type of container to store the tuple.
+     * @param[in] radices - The base of each coordinate (all >= 1; otherwise
+     * there are no tuples and nothing is yielded).
+     * @return A generator that yields each tuple, starting from all zeros.
+     */
+    template <typename Container> auto mixed_radix_gray(std::vector<int> radices)
+        -> py::Generator<Container&> {
+        for (const auto radix : radices) {
+            if (radix < 1) {
+                co_return;
+            }
+        }
+        auto lst = Container(radices.size(), 0);
+        co_yield lst;
+        for (const auto& [coord, delta] : mixed_radix_gray_gen(std::move(radices))) {
+            lst[static_cast<typename Container::size_type>(coord)] += delta;
+            co_yield lst;
+        }
+    }
 }  // namespace ecgen
@@ -0,0 +1,300 @@
+/**
+ * @file integer_partition.hpp
+ * @brief Compositions and partitions of an integer with a small change per step
+ *
+ * A composition of n lists positive parts summing to n; the n-1 gaps between
+ * n units are either cut or not, so the compositions correspond to bit
+ * strings of length n-1. Taking them in binary reflected Gray code order
+ * (brgc_gen(n-1)), each step toggles one cut: a part splits in two or two
+ * neighbouring parts merge.
+ * @verbatim
+ *    4 -> 1 3 -> 1 1 2 -> 2 2 -> 2 1 1 -> 1 1 1 1 -> 1 2 1 -> 3 1
+ * @endverbatim
+ *
+ * With exactly k parts in [min_part, max_part], each step moves one unit
+ * from one part to another. The list is built on the last part x: the
+ * sublists for x = lo, ..., hi are concatenated, the one for x being
+ * reversed when x is odd. Consecutive sublists then meet at their first or
+ * last compositions, which differ by one unit in a part read off a table.
+ *
+ * Partitions of n with parts at most max_part are visited in reverse
+ * lexicographic order and kept as multiplicities: each step changes at most
+ * four of them, so a sum over the parts is updated in constant time.
+ * @verbatim
+ *    4 -> 3 1 -> 2 2 -> 2 1 1 -> 1 1 1 1
+ * @endverbatim
+ *
+ * References:
+ * T. Walsh. Loop-free sequencing of bounded integer compositions. J.
+ * Combin. Math. Combin. Comput. 33 (2000), 323-345.
+ * A. Zoghbi, I. Stojmenovic. Fast algorithms for generating integer
+ * partitions. Int. J. Comput. Math. 70 (1998), 319-332.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ecgen/step_iterator.hpp>
+#include <iterator>  // for default_sentinel_t
+#include <span>
+#include <vector>
+
+namespace ecgen {
+
+    /**
+     * @brief Generator of the compositions of n in Gray code order
+     *
+     * Starts at the single part n. Step i toggles the cut brgc_gen(n-1)
+     * yields at step i, found by counting trailing zeros, and the parts are
+     * updated in place without allocating. Locating the changed part takes
+     * O(1) bit operations, but the split or merge shifts the parts behind
+     * it, so a step costs O(number of parts), at most n <= 64 moves.
+     *
+     * Example:
+     * @code
+     *    for (const auto& comp : ecgen::Compositions(4)) {
+     *        auto parts = comp.parts();  // 4, then 1 3, 1 1 2, ...
+     *        auto i = comp.index();      // parts[i] is new (split) or merged
+     *    }
+     * @endcode
+     */
+    class Compositions {
+      public:
+        /// Visits the compositions; dereferences to the generator itself
+        using iterator = StepIterator<Compositions>;
+
+        /**
+         * @brief Construct a new Compositions object
+         *
+         * @param[in] n - The number to split (0 .. 64; 0 gives the empty
+         * composition, otherwise nothing is generated).
+         */
+        explicit Compositions(int n);
+
+        /// The current parts
+        auto parts() const noexcept -> std::span<const int> { return this->_parts; }
+
+        /**
+         * @brief The part changed by the last step (-1 at the start)
+         *
+         * After a split, parts[index()] and parts[index() + 1] are the two
+         * halves; after a merge, parts[index()] is their sum.
+         */
+        auto index() const noexcept -> int { return this->_index; }
+
+        /// Whether the last step split a part (false for a merge)
+        auto split() const noexcept -> bool { return this->_split; }
+
+        /// Whether there is nothing to generate
+        auto empty() const noexcept -> bool { return this->_empty; }
+
+        /**
+         * @brief Advance to the next composition
+         *
+         * @return false after the last composition.
+         */
+        auto next() -> bool;
+
+        auto begin() -> iterator { return iterator{this}; }
+        auto end() const noexcept -> std::default_sentinel_t { return {}; }
+
+      private:
+        std::vector<int> _parts;  ///< reserved for n parts
+        std::uint64_t _cuts{0};   ///< bit j: a cut after unit j+1
+        std::uint64_t _step{0};
+        std::uint64_t _steps{0};  ///< 2^(n-1) - 1
+        int _index{-1};
+        bool _split{false};
+        bool _empty{false};
+    };
+
+    /**
+     * @brief Compositions into k bounded parts, one unit moved per step
+     *
+     * Example (budgets of 6 over 3 resources holding 0 .. 4 each):
+     * @code
+     *    auto gen = ecgen::BoundedCompositions(6, 3, 4);
+     *    gen.run([](std::span<const int> parts, int from, int to) {
+     *        // 4 2 0 first; afterwards one unit went from parts[from] to parts[to]
+     *        return true;
+     *    });
+     * @endcode
+     */
+    class BoundedCompositions {
+      public:
+        /**
+         * @brief Construct a new Bounded Compositions object
+         *
+         * @param[in] n - The sum of the parts.
+         * @param[in] k - The number of parts (at least 1).
+         * @param[in] max_part - The largest allowed part.
+         * @param[in] min_part - The smallest allowed part (at least 0).
+         */
+        BoundedCompositions(int n, int k, int max_part, int min_part = 0);
+
+        /**
+         * @brief Visit the compositions in Gray code order
+         *
+         * The first composition fills the parts greedily from the front.
+         * Every later call reports the step as the parts `from` and `to` that
+         * lost and gained a unit; the first call has from == to == -1.
+         *
+         * @tparam Visit - callable as bool(std::span<const int>, int, int); the
+         * view is valid during the call only, false stops the walk.
+         * @return false if the walk was stopped by `visit`.
+         */
+        template <typename Visit> auto run(Visit&& visit) -> bool {
+            if (this->_k < 1) {
+                return true;
+            }
+            auto t = this->_n;
+            for (auto& part : this->_parts) {
+                const auto x = t < this->_m ? t : this->_m;
+                part = this->_min + x;
+                t -= x;
+            }
+            if (!visit(std::span<const int>(this->_parts), -1, -1)) {
+                return false;
+            }
+            return this->_gen(this->_k, this->_n, true, visit);
+        }
+
+      private:
+        /// Walk parts[0 .. j-1] summing to t (above the minimum), forwards or backwards
+        template <typename Visit> auto _gen(int j, int t, bool forward, Visit& visit) -> bool {
+            if (j == 1 || t == 0 || t == j * this->_m) {
+                return true;  // a single composition
+            }
+            const auto lo = t > (j - 1) * this->_m ? t - (j - 1) * this->_m : 0;
+            const auto hi = t < this->_m ? t : this->_m;
+            const auto last = j - 1;
+            for (auto i = 0; i <= hi - lo; ++i) {
+                const auto x = forward ? lo + i : hi - i;
+                if (i != 0) {
+                    // sublists y and y+1 meet at their last compositions if y is
+                    // even (y forwards, y+1 backwards), else at their first ones
+                    const auto y = forward ? x - 1 : x;
+                    const auto other = y % 2 == 0 ? this->_last_down(j - 1, t - y)
+                                                  : this->_first_down(j - 1, t - y);
+                    const auto from = forward ? other : last;
+                    const auto to = forward ? last : other;
+                    --this->_parts[static_cast<std::size_t>(from)];
+                    ++this->_parts[static_cast<std::size_t>(to)];
+                    if (!visit(std::span<const int>(this->_parts), from, to)) {
+                        return false;
+                    }
+                }
+                if (!this->_gen(j - 1, t - x, forward == (x % 2 == 0), visit)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /// The part losing a unit from the first composition of (j, t) to that of (j, t-1)
+        auto _first_down(int j, int t) const -> int {
+            return this->_first[static_cast<std::size_t>(j * (this->_n + 1) + t)];
+        }
+
+        /// The same for the last compositions
+        auto _last_down(int j, int t) const -> int {
+            return this->_last[static_cast<std::size_t>(j * (this->_n + 1) + t)];
+        }
+
+        int _n;    ///< the sum above k * min_part
+        int _k;    ///< 0 if there is nothing to generate
+        int _m;    ///< max_part - min_part
+        int _min;  ///< min_part
+        std::vector<int> _parts;
+        std::vector<int> _first;  ///< _first_down by j * (n+1) + t
+        std::vector<int> _last;   ///< _last_down by j * (n+1) + t
+    };
+
+    /// The multiplicity of `part` changed by `count`
+    struct PartChange {
+        int part;
+        int count;
+    };
+
+    /**
+     * @brief Loopless generator of the partitions of n in multiplicity form
+     *
+     * A partition is held as its distinct parts in decreasing order with
+     * their multiplicities. Each step removes one copy of the smallest part
+     * x > 1 together with the ones, and refills their sum with parts x-1 and
+     * a remainder, so changes() has at most four entries.
+     *
+     * Example (a sum of g(part) kept up to date):
+     * @code
+     *    for (const auto& part : ecgen::IntegerPartitions(10, 4)) {
+     *        for (const auto& [value, count] : part.changes()) {
+     *            total += count * g(value);
+     *        }
+     *    }
+     * @endcode
+     */
+    class IntegerPartitions {
+      public:
+        /// Visits the partitions; dereferences to the generator itself
+        using iterator = StepIterator<IntegerPartitions>;
+
+        /**
+         * @brief Construct a new Integer Partitions object
+         *
+         * @param[in] n - The number to split (0 gives the empty partition; a
+         * negative n generates nothing).
+         * @param[in] max_part - The largest allowed part (at least 1 unless
+         * n == 0); defaults to n.
+         */
+        IntegerPartitions(int n, int max_part);
+        explicit IntegerPartitions(int n) : IntegerPartitions(n, n) {}
+
+        /// The distinct parts in decreasing order
+        auto values() const noexcept -> std::span<const int> {
+            return {this->_value.data(), this->_top};
+        }
+
+        /// The multiplicity of each of values()
+        auto counts() const noexcept -> std::span<const int> {
+            return {this->_count.data(), this->_top};
+        }
+
+        /// The multiplicity of `part` (1 .. min(n, max_part)), O(1)
+        auto multiplicity(int part) const noexcept -> int {
+            return this->_mult[static_cast<std::size_t>(part)];
+        }
+
+        /// The multiplicities changed by the last step (all of them at the start)
+        auto changes() const noexcept -> std::span<const PartChange> {
+            return {this->_changes.data(), this->_num_changes};
+        }
+
+        /// Whether there is nothing to generate
+        auto empty() const noexcept -> bool { return this->_empty; }
+
+        /**
+         * @brief Advance to the next partition
+         *
+         * @return false after the last partition (all ones).
+         */
+        auto next() -> bool;
+
+        auto begin() -> iterator { return iterator{this}; }
+        auto end() const noexcept -> std::default_sentinel_t { return {}; }
+
+      private:
+        void _push(int value, int count);
+        void _change(int part, int count);
+
+        std::vector<int> _value;  ///< distinct parts, _value[0] the largest
+        std::vector<int> _count;
+        std::size_t _top{0};    ///< the number of distinct parts
+        std::vector<int> _mult;  ///< by part, 0 .. max_part
+        std::array<PartChange, 4> _changes{};
+        std::size_t _num_changes{0};
+        bool _empty{false};
+    };
+
+}  // namespace ecgen
@@ -0,0 +1,61 @@
+/**
+ * @file mapped_file.hpp
+ * @brief Read-only view of a whole file, memory-mapped where available
+ *
+ * On POSIX systems the file is mapped with mmap(), so processes reading the
+ * same file share its pages through the page cache. Elsewhere the file is
+ * read into memory, which keeps the same interface.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace ecgen {
+
+    /**
+     * @brief Read-only contents of a file (move-only)
+     *
+     * Example:
+     * @code
+     *    if (auto file = ecgen::MappedFile::open("moves.bin")) {
+     *        const auto* bytes = file->data();  // file->size() bytes
+     *    }
+     * @endcode
+     */
+    class MappedFile {
+      public:
+        /**
+         * @brief Map a file
+         *
+         * @param[in] path - The file.
+         * @return std::nullopt if the file cannot be opened or read.
+         */
+        static auto open(const std::string& path) -> std::optional<MappedFile>;
+
+        MappedFile(MappedFile&& other) noexcept;
+        auto operator=(MappedFile&& other) noexcept -> MappedFile&;
+        MappedFile(const MappedFile&) = delete;
+        auto operator=(const MappedFile&) -> MappedFile& = delete;
+        ~MappedFile();
+
+        auto data() const noexcept -> const std::byte* { return this->_data; }
+        auto size() const noexcept -> std::size_t { return this->_size; }
+
+        /// Whether the contents are mapped rather than copied
+        auto is_mapped() const noexcept -> bool { return this->_mapped; }
+
+      private:
+        MappedFile() = default;
+        void _release() noexcept;
+
+        const std::byte* _data{nullptr};
+        std::size_t _size{0};
+        bool _mapped{false};
+        std::vector<std::byte> _copy;  ///< contents when mmap() is not available
+    };
+
+}  // namespace ecgen
@@ -0,0 +1,199 @@
+/**
+ * @file multiset_perm.hpp
+ * @brief Multiset permutations in cool order, one prefix shift per step
+ *
+ * sjt() visits all n! orders of n items even when some of them are equal.
+ * Williams' cool order visits every distinct arrangement of a multiset once:
+ * each step takes the item at some position r and moves it to the front,
+ * shifting the prefix 0 .. r-1 one place to the right. Kept as a linked
+ * list, the arrangement changes by a constant number of pointer updates
+ * per step, so the generator is loopless.
+ *
+ * @verbatim
+ *    multiplicities {1, 2} (values 0, 1, 1):
+ *    1 1 0 -> 0 1 1 -> 1 0 1 -> 1 1 0 ...  (three arrangements, r = 2, 1)
+ * @endverbatim
+ *
+ * Reference:
+ * A. Williams. Loopless generation of multiset permutations using a
+ * constant number of variables by prefix shifts. SODA 2009, 987-996.
+ */
+
+#pragma once
+
+#include <algorithm>  // for sort, reverse, rotate
+#include <cstddef>
+#include <ecgen/step_iterator.hpp>
+#include <functional>  // for greater
+#include <iterator>    // for default_sentinel_t
+#include <py2cpp/gen.hpp>
+#include <span>
+#include <vector>
+
+namespace ecgen {
+
+    /**
+     * @brief Loopless generator of the distinct arrangements of a multiset
+     *
+     * The multiset holds `counts[v]` copies of each value v. It starts in
+     * non-increasing order and allocates only in the constructor.
+     *
+     * Example (the 6 arrangements of 0, 0, 1, 1):
+     * @code
+     *    auto counts = std::vector{2, 2};
+     *    for (const auto& perm : ecgen::MultisetPerm(counts)) {
+     *        perm.for_each([](int value) { ... });  // O(n), or
+     *        auto r = perm.shift();  // the item at r moved to the front
+     *    }
+     * @endcode
+     */
+    class MultisetPerm {
+      public:
+        /// Visits the arrangements; dereferences to the generator itself
+        using iterator = StepIterator<MultisetPerm>;
+
+        /**
+         * @brief Start at the non-increasing arrangement
+         *
+         * @param[in] counts - The multiplicity of each value 0, 1, ...
+         * (a negative count generates nothing; all zero gives the single
+         * empty arrangement).
+         */
+        explicit MultisetPerm(std::span<const int> counts) {
+            auto n = 0;
+            for (const auto count : counts) {
+                if (count < 0) {
+                    this->_empty = true;
+                    return;
+                }
+                n += count;
+            }
+            this->_value.reserve(static_cast<std::size_t>(n));
+            for (auto v = int(counts.size()) - 1; v >= 0; --v) {
+                const auto count = static_cast<std::size_t>(counts[static_cast<std::size_t>(v)]);
+                this->_value.insert(this->_value.end(), count, v);
+            }
+            this->_next.resize(static_cast<std::size_t>(n));
+            for (auto p = 0; p < n; ++p) {
+                this->_next[static_cast<std::size_t>(p)] = p + 1 < n ? p + 1 : -1;
+            }
+            this->_head = n > 0 ? 0 : -1;
+            this->_i = n - 2;  // the second to last node
+            this->_pos_i = n - 2;
+            this->_last = n < 2;
+        }
+
+        /// The number of items
+        auto size() const noexcept -> int { return int(this->_value.size()); }
+
+        /// Whether there is nothing to generate
+        auto empty() const noexcept -> bool { return this->_empty; }
+
+        /// The position whose item the last step moved to the front (0 at the start)
+        auto shift() const noexcept -> int { return this->_shift; }
+
+        /// The value at the front
+        auto front() const noexcept -> int {
+            return this->_value[static_cast<std::size_t>(this->_head)];
+        }
+
+        /**
+         * @brief Visit the current arrangement from front to back, O(n)
+         *
+         * @param[in] visit - called as visit(int value) for every item.
+         */
+        template <typename Visit> void for_each(Visit&& visit) const {
+            for (auto node = this->_head; node >= 0; node = this->_next[std::size_t(node)]) {
+                visit(this->_value[static_cast<std::size_t>(node)]);
+            }
+        }
+
+        /**
+         * @brief Advance to the next arrangement
+         *
+         * @return false after the last arrangement.
+         */
+        auto next() noexcept -> bool {
+            if (this->_last) {
+                return false;
+            }
+            const auto& value = this->_value;
+            const auto& link = this->_next;
+            const auto value_of = [&value](int node) { return value[std::size_t(node)]; };
+            const auto next_of = [&link](int node) { return link[std::size_t(node)]; };
+
+            const auto i = this->_i;
+            const auto j = next_of(i);
+            const auto head = this->_head;
+            if (next_of(j) < 0 && value_of(j) >= value_of(head)) {
+                this->_last = true;
+                return false;
+            }
+            // s is i or j; its successor t moves to the front
+            const auto use_j = next_of(j) >= 0 && value_of(i) >= value_of(next_of(j));
+            const auto s = use_j ? j : i;
+            const auto t = next_of(s);
+            this->_shift = this->_pos_i + (use_j ? 2 : 1);
+            this->_next[std::size_t(s)] = next_of(t);
+            this->_next[std::size_t(t)] = head;
+            if (value_of(t) < value_of(head)) {
+                this->_i = t;
+                this->_pos_i = 0;
+            } else {
+                ++this->_pos_i;  // i was in front of t
+            }
+            this->_head = t;
+            return true;
+        }
+
+        auto begin() -> iterator { return iterator{this}; }
+        auto end() const noexcept -> std::default_sentinel_t { return {}; }
+
+      private:
+        std::vector<int> _value;  ///< the value of every node
+        std::vector<int> _next;   ///< the successor of every node, -1 at the end
+        int _head{-1};
+        int _i{-1};      ///< Williams' i; its successor is j
+        int _pos_i{-1};  ///< the position of node i
+        int _shift{0};
+        bool _last{true};    ///< no further arrangement
+        bool _empty{false};  ///< nothing to generate
+    };
+
+    /**
+     * @brief Generate the distinct arrangements of a container in cool order
+     *
+     * The container is first sorted into non-increasing order, then every
+     * step rotates a prefix by one place (O(r) for a shift of length r), so
+     * each distinct arrangement is yielded exactly once.
+     *
+     * @tparam Container - a random-access container with comparable items
+     * @param[in,out] seq - The items; left in the last arrangement.
+     * @return py::Generator<Container&>
+     */
+    template <typename Container>
+    inline auto multiset_perm(Container& seq) -> py::Generator<Container&> {
+        std::sort(seq.begin(), seq.end(), std::greater<>{});
+        // multiplicities by rank, the smallest item being value 0
+        auto counts = std::vector<int>{};
+        for (auto it = seq.begin(); it != seq.end();) {
+            auto last = it;
+            while (last != seq.end() && !(*last < *it)) {
+                ++last;
+            }
+            counts.push_back(int(last - it));
+            it = last;
+        }
+        std::reverse(counts.begin(), counts.end());
+        auto gen = MultisetPerm(counts);
+        for (auto it = gen.begin(); it != gen.end(); ++it) {
+            // the first arrangement (shift 0) needs no move, and seq may be empty
+            const auto shift = static_cast<std::ptrdiff_t>((*it).shift());
+            if (shift != 0) {
+                std::rotate(seq.begin(), seq.begin() + shift, seq.begin() + shift + 1);
+            }
+            co_yield seq;
+        }
+    }
+
+}  // namespace ecgen
@@ -0,0 +1,168 @@
+/**
+ * @file necklace.hpp
+ * @brief Prenecklaces, necklaces and Lyndon words by the FKM algorithm
+ *
+ * A necklace is a k-ary word that is the smallest of its rotations, a
+ * Lyndon word is an aperiodic necklace and a prenecklace is a prefix of a
+ * necklace. The FKM algorithm (Fredricksen, Kessler, Maiorana) builds the
+ * prenecklaces of length n in lexicographic order as a tree: position t
+ * either repeats a[t-p], keeping the period p, or takes a larger symbol,
+ * making the prefix a Lyndon word of period t. At the leaves
+ * @verbatim
+ *    n % p == 0   the word is a necklace
+ *    p == n       the word is a Lyndon word
+ * @endverbatim
+ * and the whole walk takes constant amortized time per word.
+ *
+ * Reference:
+ * F. Ruskey, C. Savage, T. M. Y. Wang. Generating necklaces. J. Algorithms
+ * 13 (1992), 414-430.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <ecgen/work_stealing_pool.hpp>
+#include <span>
+#include <vector>
+
+namespace ecgen {
+
+    /// The words visited by Necklaces
+    enum class NecklaceKind { prenecklace, necklace, lyndon };
+
+    /**
+     * @brief Depth-first FKM generator of necklaces and related words
+     *
+     * Example (the 8 binary necklaces of length 5):
+     * @code
+     *    auto gen = ecgen::Necklaces(5, 2, ecgen::NecklaceKind::necklace);
+     *    gen.run([](std::span<const int> word) {
+     *        // 00000, 00001, 00011, 00101, 00111, 01011, 01111, 11111
+     *        return true;
+     *    });
+     * @endcode
+     */
+    class Necklaces {
+      public:
+        /**
+         * @brief Construct a new Necklaces object
+         *
+         * @param[in] n - The word length (at least 1; otherwise nothing is
+         * generated).
+         * @param[in] k - The alphabet size, symbols 0 .. k-1 (at least 1).
+         * @param[in] kind - The words to visit.
+         */
+        Necklaces(int n, int k, NecklaceKind kind = NecklaceKind::necklace)
+            : _n{n}, _k{k}, _kind{kind} {}
+
+        /**
+         * @brief Visit the words in lexicographic order
+         *
+         * @tparam Visit - callable as bool(std::span<const int>); the view
+         * is valid during the call only, false stops the walk.
+         * @return false if the walk was stopped by `visit`.
+         */
+        template <typename Visit> auto run(Visit&& visit) -> bool {
+            this->_stop.store(false, std::memory_order_relaxed);
+            if (this->_n < 1 || this->_k < 1) {
+                return true;
+            }
+            auto word = std::vector<int>(static_cast<std::size_t>(this->_n) + 1, 0);
+            return this->_gen(word, 1, 1, visit);
+        }
+
+        /**
+         * @brief Visit the words on a pool
+         *
+         * The prefixes are split at the smallest depth that gives about 16
+         * subtrees per worker, and each subtree is walked as a task. `visit`
+         * is called concurrently and must be thread-safe; within a subtree
+         * the words are still in lexicographic order. After `visit` returns
+         * false the other workers stop at their next node.
+         *
+         * @param[in] pool - The pool.
+         * @return false if the walk was stopped by `visit`.
+         */
+        template <typename Visit> auto run(WorkStealingPool& pool, Visit&& visit) -> bool {
+            this->_stop.store(false, std::memory_order_relaxed);
+            if (this->_n < 1 || this->_k < 1) {
+                return true;
+            }
+            const auto size = static_cast<std::size_t>(this->_n) + 1;
+            auto tasks = std::vector<Task>{};
+            tasks.push_back(Task{std::vector<int>(size, 0), 1, 1});
+            split_frontier(pool, tasks, 0, this->_n,
+                           [this](Task& task, int, std::vector<Task>& children) {
+                               this->_split(task, children);
+                           });
+            pool.parallel_for(0, tasks.size(), [&](std::size_t i) {
+                auto& task = tasks[i];
+                this->_gen(task.word, task.t, task.p, visit);
+            });
+            return !this->_stop.load(std::memory_order_relaxed);
+        }
+
+      private:
+        /// A subtree: the prefix word[1 .. t-1] with period p
+        struct Task {
+            std::vector<int> word;
+            int t;
+            int p;
+        };
+
+        /// Fill word[t ..] (1-based; word[0] is unused) below period p
+        template <typename Visit>
+        auto _gen(std::vector<int>& word, int t, int p, Visit& visit) -> bool {
+            if (t > this->_n) {
+                if (this->_accept(p)
+                    && !visit(std::span<const int>(word.data() + 1, word.size() - 1))) {
+                    this->_stop.store(true, std::memory_order_relaxed);
+                    return false;
+                }
+                return !this->_stop.load(std::memory_order_relaxed);
+            }
+            const auto pos = static_cast<std::size_t>(t);
+            const auto repeat = word[pos - static_cast<std::size_t>(p)];
+            word[pos] = repeat;
+            if (!this->_gen(word, t + 1, p, visit)) {
+                return false;
+            }
+            for (auto symbol = repeat + 1; symbol < this->_k; ++symbol) {
+                word[pos] = symbol;
+                if (!this->_gen(word, t + 1, t, visit)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /// Append the subtrees one position below a task
+        void _split(Task& task, std::vector<Task>& children) const {
+            const auto pos = static_cast<std::size_t>(task.t);
+            const auto repeat = task.word[pos - static_cast<std::size_t>(task.p)];
+            for (auto symbol = repeat; symbol < this->_k; ++symbol) {
+                task.word[pos] = symbol;
+                children.push_back(Task{task.word, task.t + 1, symbol == repeat ? task.p : task.t});
+            }
+        }
+
+        auto _accept(int p) const noexcept -> bool {
+            switch (this->_kind) {
+                case NecklaceKind::necklace:
+                    return this->_n % p == 0;
+                case NecklaceKind::lyndon:
+                    return p == this->_n;
+                default:
+                    return true;
+            }
+        }
+
+        int _n;
+        int _k;
+        NecklaceKind _kind;
+        std::atomic<bool> _stop{false};
+    };
+
+}  // namespace ecgen
@@ -5,8 +5,11 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <py2cpp/gen.hpp>
 #include <type_traits>  // for integral_constant
+#include <vector>
 
 namespace ecgen {
     /**
@@ -27,6 +30,76 @@ namespace ecgen {
      */
     extern auto sjt_gen(int n) -> py::Generator<int>;
 
+    /**
+     * @brief The sjt_gen() index stream without a coroutine
+     *
+     * Knuth's Algorithm P (plain changes) keeps a direction and an offset for
+     * every element and finds the next adjacent transposition in constant
+     * amortized time, without allocating after construction. It yields the
+     * same indices as sjt_gen(n) except the final swap that returns to the
+     * starting permutation, i.e. n! - 1 indices for n >= 2.
+     *
+     * @code
+     *    auto sjt = ecgen::SjtIndex(n);
+     *    for (auto idx = sjt.next(); idx >= 0; idx = sjt.next()) {
+     *        std::swap(perm[idx], perm[idx + 1]);
+     *    }
+     * @endcode
+     */
+    class SjtIndex {
+      public:
+        /**
+         * @brief Construct a new Sjt Index object
+         *
+         * @param[in] n - The permutation length.
+         */
+        explicit SjtIndex(int n)
+            : _n{n},
+              _offset(static_cast<std::size_t>(n < 0 ? 1 : n + 1), 0),
+              _dir(static_cast<std::size_t>(n < 0 ? 1 : n + 1), 1),
+              _done{n < 2} {}
+
+        /**
+         * @brief The next swap
+         *
+         * @return idx such that positions idx and idx + 1 are swapped, or -1
+         * after the last permutation.
+         */
+        auto next() noexcept -> int {
+            if (this->_done) {
+                return -1;
+            }
+            auto j = static_cast<std::size_t>(this->_n);
+            auto shift = 0;
+            for (;;) {
+                const auto q = this->_offset[j] + this->_dir[j];
+                if (q < 0) {
+                    this->_dir[j] = -this->_dir[j];
+                    --j;
+                } else if (q == int(j)) {
+                    if (j == 1) {
+                        this->_done = true;
+                        return -1;
+                    }
+                    ++shift;
+                    this->_dir[j] = -this->_dir[j];
+                    --j;
+                } else {
+                    const auto a = int(j) - this->_offset[j] + shift;
+                    const auto b = int(j) - q + shift;
+                    this->_offset[j] = q;
+                    return (a < b ? a : b) - 1;
+                }
+            }
+        }
+
+      private:
+        int _n;
+        std::vector<int> _offset;  ///< c_j of Algorithm P (1-based)
+        std::vector<int> _dir;     ///< o_j of Algorithm P, +1 or -1
+        bool _done;
+    };
+
     /**
      * @brief Generate permutation indices using Eades-Hickey-Read (EHR) algorithm
      *
@@ -72,6 +145,23 @@ namespace ecgen {
         }
     }
 
+    /**
+     * @brief Compute factorial n! at run time
+     *
+     * The run-time counterpart of Factorial<N>(), e.g. for the number of
+     * permutations below a prefix of a search tree.
+     *
+     * @param[in] n - The number (at most 20, so that n! fits).
+     * @return The factorial of n.
+     */
+    constexpr auto factorial(int n) -> std::uint64_t {
+        auto result = std::uint64_t{1};
+        for (int i = 2; i <= n; ++i) {
+            result *= static_cast<std::uint64_t>(i);
+        }
+        return result;
+    }
+
     /**
      * @brief Generate all permutations via adjacent transpositions (SJT algorithm)
      *
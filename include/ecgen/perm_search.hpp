@@ -0,0 +1,219 @@
+/**
+ * @file perm_search.hpp
+ * @brief Branch-and-bound search over permutations, built position by position
+ *
+ * sjt() and ehr_gen() always walk all n! permutations. PermSearch fills the
+ * positions 0, 1, ... of a permutation of {0, ..., n-1} one at a time and
+ * asks a bound callback about every prefix, so a hopeless prefix of length
+ * d removes all (n-d)! permutations below it at once. This is the usual
+ * shape of assignment and TSP-style searches.
+ *
+ * In the parallel mode the prefixes of a split depth are enumerated first
+ * (with the same bound), then searched as independent tasks on a
+ * WorkStealingPool.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <ecgen/perm.hpp>
+#include <ecgen/progress.hpp>
+#include <ecgen/work_stealing_pool.hpp>
+#include <numeric>  // for iota
+#include <span>
+#include <utility>  // for move, swap
+#include <vector>
+
+namespace ecgen {
+
+    /// Counters of a PermSearch run
+    struct PermSearchStats {
+        std::uint64_t nodes{0};    ///< prefixes passed to the bound
+        std::uint64_t pruned{0};   ///< prefixes rejected by the bound
+        std::uint64_t leaves{0};   ///< complete permutations visited
+        std::uint64_t covered{0};  ///< leaves plus all permutations below pruned prefixes
+
+        void merge(const PermSearchStats& other) {
+            this->nodes += other.nodes;
+            this->pruned += other.pruned;
+            this->leaves += other.leaves;
+            this->covered += other.covered;
+        }
+    };
+
+    /**
+     * @brief Depth-first permutation search with prefix pruning
+     *
+     * Example (cheapest tour through 0 of a distance matrix `dist`):
+     * @code
+     *    auto search = ecgen::PermSearch(n);
+     *    auto best = INT_MAX;
+     *    search.run(
+     *        [&](std::span<const int> prefix) {
+     *            return prefix[0] == 0 && path_cost(prefix) < best;
+     *        },
+     *        [&](std::span<const int> perm) {
+     *            best = std::min(best, tour_cost(perm));
+     *            return true;
+     *        });
+     * @endcode
+     *
+     * The bound and visit callbacks receive the prefix (or permutation) as a
+     * view of the search's working array, valid during the call only.
+     */
+    class PermSearch {
+      public:
+        /**
+         * @brief Construct a new Perm Search object
+         *
+         * @param[in] n - The permutation length (at most 20).
+         */
+        explicit PermSearch(int n) : _n{n} {}
+
+        /**
+         * @brief Report progress to a counter
+         *
+         * Every visited permutation and every pruned subtree adds its number
+         * of permutations, so the counter reaches n! when the search ends.
+         * It needs a slot per worker in the parallel mode.
+         *
+         * @param[in] counter - The counter (outlives the searches).
+         */
+        void set_progress(ProgressCounter& counter) noexcept { this->_progress = &counter; }
+
+        /**
+         * @brief Search on the calling thread
+         *
+         * For each prefix (lengths 1 .. n) `bound(prefix)` is called; false
+         * prunes every permutation starting with it. Complete permutations
+         * that passed every bound go to `visit(perm)`, which returns false
+         * to stop the search.
+         *
+         * @tparam Bound - callable as bool(std::span<const int>)
+         * @tparam Visit - callable as bool(std::span<const int>)
+         * @return false if the search was stopped by `visit`.
+         */
+        template <typename Bound, typename Visit> auto run(Bound&& bound, Visit&& visit) -> bool {
+            this->_stop.store(false, std::memory_order_relaxed);
+            this->_stats = PermSearchStats{};
+            if (this->_n < 0) {
+                return true;
+            }
+            auto perm = std::vector<int>(static_cast<std::size_t>(this->_n));
+            std::iota(perm.begin(), perm.end(), 0);
+            this->_walk(perm, 0, bound, visit, this->_stats, 0);
+            return !this->_stop.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Search on a pool
+         *
+         * The prefixes are split at the smallest depth that gives about 16
+         * subtrees per worker. Both callbacks are called concurrently and
+         * must be thread-safe; after `visit` returns false the other workers
+         * stop at their next node.
+         *
+         * @param[in] pool - The pool.
+         * @return false if the search was stopped by `visit`.
+         */
+        template <typename Bound, typename Visit>
+        auto run(WorkStealingPool& pool, Bound&& bound, Visit&& visit) -> bool {
+            this->_stop.store(false, std::memory_order_relaxed);
+            this->_stats = PermSearchStats{};
+            if (this->_n < 2) {
+                return this->run(bound, visit);
+            }
+            auto root = std::vector<int>(static_cast<std::size_t>(this->_n));
+            std::iota(root.begin(), root.end(), 0);
+            auto tasks = std::vector<std::vector<int>>{};
+            tasks.push_back(std::move(root));
+            auto split_stats = PermSearchStats{};
+            const auto depth = split_frontier(
+                pool, tasks, 0, this->_n - 1,
+                [&](std::vector<int>& perm, int level, std::vector<std::vector<int>>& children) {
+                    this->_split(perm, level, bound, children, split_stats);
+                });
+
+            auto worker_stats = std::vector<PermSearchStats>(pool.num_workers());
+            pool.parallel_for(0, tasks.size(), [&](std::size_t i) {
+                const auto slot = static_cast<unsigned>(pool.worker_index());
+                this->_walk(tasks[i], depth, bound, visit, worker_stats[slot], slot);
+            });
+            // credited once the workers are done, from the caller's own slot
+            if (this->_progress != nullptr) {
+                const auto index = pool.worker_index();
+                this->_progress->add(index < 0 ? 0U : static_cast<unsigned>(index),
+                                     split_stats.covered);
+            }
+            this->_stats = split_stats;
+            for (const auto& stats : worker_stats) {
+                this->_stats.merge(stats);
+            }
+            return !this->_stop.load(std::memory_order_relaxed);
+        }
+
+        auto stats() const noexcept -> const PermSearchStats& { return this->_stats; }
+
+      private:
+        template <typename Bound, typename Visit>
+        void _walk(std::vector<int>& perm, int depth, Bound& bound, Visit& visit,
+                   PermSearchStats& stats, unsigned slot) {
+            if (depth == this->_n) {
+                ++stats.leaves;
+                this->_count(stats, 1, slot);
+                if (!visit(std::span<const int>(perm))) {
+                    this->_stop.store(true, std::memory_order_relaxed);
+                }
+                return;
+            }
+            const auto pos = static_cast<std::size_t>(depth);
+            for (auto i = pos; i != perm.size(); ++i) {
+                if (this->_stop.load(std::memory_order_relaxed)) {
+                    return;
+                }
+                std::swap(perm[pos], perm[i]);
+                ++stats.nodes;
+                if (bound(std::span<const int>(perm.data(), pos + 1))) {
+                    this->_walk(perm, depth + 1, bound, visit, stats, slot);
+                } else {
+                    ++stats.pruned;
+                    this->_count(stats, factorial(this->_n - depth - 1), slot);
+                }
+                std::swap(perm[pos], perm[i]);
+            }
+        }
+
+        /// Append the accepted extensions of a prefix of length `depth`
+        template <typename Bound>
+        void _split(std::vector<int>& perm, int depth, Bound& bound,
+                    std::vector<std::vector<int>>& children, PermSearchStats& stats) {
+            const auto pos = static_cast<std::size_t>(depth);
+            for (auto i = pos; i != perm.size(); ++i) {
+                std::swap(perm[pos], perm[i]);
+                ++stats.nodes;
+                if (bound(std::span<const int>(perm.data(), pos + 1))) {
+                    children.push_back(perm);
+                } else {
+                    ++stats.pruned;
+                    stats.covered += factorial(this->_n - depth - 1);
+                }
+                std::swap(perm[pos], perm[i]);
+            }
+        }
+
+        void _count(PermSearchStats& stats, std::uint64_t leaves, unsigned slot) {
+            stats.covered += leaves;
+            if (this->_progress != nullptr) {
+                this->_progress->add(slot, leaves);
+            }
+        }
+
+        int _n;
+        ProgressCounter* _progress{nullptr};
+        std::atomic<bool> _stop{false};
+        PermSearchStats _stats;
+    };
+
+}  // namespace ecgen
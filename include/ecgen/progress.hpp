@@ -0,0 +1,168 @@
+/**
+ * @file progress.hpp
+ * @brief Progress, rate and ETA reporting for long enumerations
+ *
+ * The hot loop only bumps a counter in a cache line owned by its thread. A
+ * separate reporter thread sums the counters periodically and logs the
+ * progress with spdlog.
+ *
+ * Example:
+ * @code
+ *    auto counter = ecgen::ProgressCounter(1);
+ *    // emk_comb_gen() yields one transition less than there are combinations
+ *    auto reporter = ecgen::ProgressReporter(counter, "emk_comb",
+ *                                            ecgen::Combination<30, 15>() - 1);
+ *    for ([[maybe_unused]] auto [x, y] : ecgen::emk_comb_gen(30, 15)) {
+ *        counter.add(0);
+ *    }
+ * @endcode
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace ecgen {
+
+    /**
+     * @brief Per-thread item counters, each in its own cache line
+     *
+     * Every slot must be written by a single thread at a time (e.g. slot
+     * pool.worker_index() of a WorkStealingPool); any thread may read.
+     */
+    class ProgressCounter {
+      public:
+        /**
+         * @brief Construct a new Progress Counter object
+         *
+         * @param[in] num_slots - The number of writer threads.
+         */
+        explicit ProgressCounter(unsigned num_slots = 1)
+            : _slots{std::make_unique<Slot[]>(num_slots)}, _num_slots{num_slots} {}
+
+        /**
+         * @brief Count items of one slot
+         *
+         * A relaxed load and store, no read-modify-write: cheap enough to be
+         * called once per generated item.
+         *
+         * @param[in] slot - The slot of the calling thread.
+         * @param[in] count - The number of items.
+         */
+        void add(unsigned slot, std::uint64_t count = 1) noexcept {
+            auto& value = this->_slots[slot].value;
+            value.store(value.load(std::memory_order_relaxed) + count, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Sum of all slots (a snapshot while writers are running)
+         *
+         * @return std::uint64_t
+         */
+        auto total() const noexcept -> std::uint64_t {
+            auto sum = std::uint64_t{0};
+            for (auto i = 0U; i != this->_num_slots; ++i) {
+                sum += this->_slots[i].value.load(std::memory_order_relaxed);
+            }
+            return sum;
+        }
+
+        auto num_slots() const noexcept -> unsigned { return this->_num_slots; }
+
+      private:
+        struct alignas(64) Slot {
+            std::atomic<std::uint64_t> value{0};
+        };
+
+        std::unique_ptr<Slot[]> _slots;
+        unsigned _num_slots;
+    };
+
+    /**
+     * @brief Progress figures derived from two samples of a counter
+     */
+    struct ProgressSnapshot {
+        std::uint64_t done{0};  ///< items so far
+        double elapsed{0.0};    ///< seconds since the start
+        double rate{0.0};       ///< items per second over the last interval
+        double fraction{-1.0};  ///< done / expected, or -1 if unknown
+        double eta{-1.0};       ///< seconds to go, or -1 if unknown
+
+        /**
+         * @brief Compute the figures for a new sample
+         *
+         * The ETA uses the overall average rate, which is steadier than the
+         * rate of the last interval for tree searches.
+         *
+         * @param[in] done - The items so far.
+         * @param[in] elapsed - The seconds since the start.
+         * @param[in] previous - The previous snapshot.
+         * @param[in] expected - The total number of items (0 if unknown).
+         * @return ProgressSnapshot
+         */
+        static auto next(std::uint64_t done, double elapsed, const ProgressSnapshot& previous,
+                         std::uint64_t expected) -> ProgressSnapshot;
+    };
+
+    /**
+     * @brief Background thread logging the progress of a ProgressCounter
+     *
+     * Logs "<name>: done/expected (pct%), rate/s, ETA h:mm:ss" through the
+     * default spdlog logger every `interval`, and a summary when stopped or
+     * destroyed.
+     */
+    class ProgressReporter {
+      public:
+        /**
+         * @brief Start reporting
+         *
+         * @param[in] counter - The counter to watch (must outlive the reporter).
+         * @param[in] name - The label of the log lines.
+         * @param[in] expected - The total number of items (0 if unknown), e.g.
+         * Combination<N, K>() or Stirling2nd<N, K>().
+         * @param[in] interval - The time between two log lines.
+         */
+        ProgressReporter(const ProgressCounter& counter, std::string name,
+                         std::uint64_t expected = 0,
+                         std::chrono::milliseconds interval = std::chrono::seconds(10));
+        ~ProgressReporter();
+
+        ProgressReporter(const ProgressReporter&) = delete;
+        auto operator=(const ProgressReporter&) -> ProgressReporter& = delete;
+
+        /**
+         * @brief Stop the reporter thread and log the summary (idempotent)
+         */
+        void stop();
+
+        /**
+         * @brief The figures of the last report
+         *
+         * @return ProgressSnapshot
+         */
+        auto last() const -> ProgressSnapshot;
+
+      private:
+        void _loop();
+        void _report(bool final);
+
+        const ProgressCounter& _counter;
+        std::string _name;
+        std::uint64_t _expected;
+        std::chrono::milliseconds _interval;
+        std::chrono::steady_clock::time_point _start;
+        ProgressSnapshot _last{};
+        mutable std::mutex _mutex;
+        std::condition_variable _cv;
+        bool _stop{false};
+        std::thread _thread;
+    };
+
+}  // namespace ecgen
@@ -0,0 +1,130 @@
+/**
+ * @file pruned_comb.hpp
+ * @brief Revolving-door enumeration of combinations with prefix pruning
+ *
+ * The revolving door order R(n, k) of the k-subsets of {0, ..., n-1} is
+ * R(n-1, k) followed by the reverse of R(n-1, k-1) with n-1 added. Reading
+ * this recursion as a decision tree on the elements n-1, n-2, ..., 0 (each
+ * excluded or included), every subtree is a contiguous block of the order,
+ * namely all combinations that agree on the decided elements. A rejected
+ * partial selection therefore removes a whole block at the cost of one
+ * call, and the combinations inside surviving blocks still change by one
+ * transposition at a time.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace ecgen {
+
+    /**
+     * @brief Depth-first revolving-door walk that skips rejected prefixes
+     *
+     * Example (3-subsets of 0 .. 9 with sum at most 12):
+     * @code
+     *    auto search = ecgen::PrunedComb(10, 3);
+     *    search.run(
+     *        [](const std::vector<int>& chosen, int) {
+     *            // adding more elements only increases the sum
+     *            return std::accumulate(chosen.begin(), chosen.end(), 0) <= 12;
+     *        },
+     *        [](const std::vector<int>& chosen) { ...; return true; });
+     * @endcode
+     */
+    class PrunedComb {
+      public:
+        /**
+         * @brief Construct a new Pruned Comb object
+         *
+         * @param[in] n - The number of elements.
+         * @param[in] k - The size of the combinations.
+         */
+        PrunedComb(int n, int k) : _n{n}, _k{k} {}
+
+        /**
+         * @brief Enumerate the combinations whose every prefix is accepted
+         *
+         * The elements are decided from n-1 down to 0. After each decision
+         * that leaves the selection completable, `accept(chosen, element)`
+         * is called, where `element` is the element just decided and
+         * `chosen` holds the included elements so far in decreasing order;
+         * returning false skips every combination extending this prefix.
+         * Complete selections are passed to `visit(chosen)`, which returns
+         * false to stop the search. Without pruning the visits follow the
+         * revolving door order, starting at {0, ..., k-1}.
+         *
+         * @tparam Accept - callable as bool(const std::vector<int>&, int)
+         * @tparam Visit - callable as bool(const std::vector<int>&)
+         * @param[in] accept - The prefix predicate.
+         * @param[in] visit - The combination callback.
+         * @return false if the search was stopped by `visit`.
+         */
+        template <typename Accept, typename Visit>
+        auto run(Accept&& accept, Visit&& visit) -> bool {
+            this->_chosen.clear();
+            this->_nodes = this->_pruned = this->_leaves = 0;
+            if (this->_k < 0 || this->_k > this->_n) {
+                return true;
+            }
+            return this->_walk(this->_n, this->_k, false, accept, visit);
+        }
+
+        /// The number of accepted decisions
+        auto nodes() const noexcept -> std::uint64_t { return this->_nodes; }
+
+        /// The number of rejected decisions (each skips a whole block)
+        auto pruned() const noexcept -> std::uint64_t { return this->_pruned; }
+
+        /// The number of visited combinations
+        auto leaves() const noexcept -> std::uint64_t { return this->_leaves; }
+
+      private:
+        /// Decide the elements m-1 .. 0 with r of them still to include
+        template <typename Accept, typename Visit>
+        auto _walk(int m, int r, bool reversed, Accept& accept, Visit& visit) -> bool {
+            if (r == 0) {  // the remaining elements are all excluded
+                ++this->_leaves;
+                return visit(static_cast<const std::vector<int>&>(this->_chosen));
+            }
+            const auto element = m - 1;
+            // forward: R(m-1, r), then reversed R(m-1, r-1) + element
+            for (auto branch = 0; branch != 2; ++branch) {
+                const auto include = (branch == 0) == reversed;
+                if (include) {
+                    this->_chosen.push_back(element);
+                    const auto stopped = this->_decide(element, accept)
+                                         && !this->_walk(m - 1, r - 1, !reversed, accept, visit);
+                    this->_chosen.pop_back();
+                    if (stopped) {
+                        return false;
+                    }
+                } else if (r < m) {  // enough elements left to exclude this one
+                    if (this->_decide(element, accept)
+                        && !this->_walk(m - 1, r, reversed, accept, visit)) {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+
+        template <typename Accept> auto _decide(int element, Accept& accept) -> bool {
+            if (accept(static_cast<const std::vector<int>&>(this->_chosen), element)) {
+                ++this->_nodes;
+                return true;
+            }
+            ++this->_pruned;
+            return false;
+        }
+
+        int _n;
+        int _k;
+        std::vector<int> _chosen;  ///< included elements, decreasing
+        std::uint64_t _nodes{0};
+        std::uint64_t _pruned{0};
+        std::uint64_t _leaves{0};
+    };
+
+}  // namespace ecgen
@@ -18,6 +18,8 @@
 
 #pragma once
 
+#include <array>
+#include <cstdint>
 #include <py2cpp/recursive_gen.hpp>
 #include <type_traits>  // for integral_constant
 
@@ -71,4 +73,98 @@ namespace ecgen {
      */
     extern auto set_bipart_gen(int n) -> py::RecursiveGenerator<int>;
 
+    /**
+     * @brief Non-coroutine bipartition engine with bit-mask state
+     *
+     * Produces exactly the same move sequence as set_bipart_gen(n), but keeps
+     * the recursion on an explicit fixed-size stack and the current
+     * bipartition in a single 64-bit mask, so no allocation happens after
+     * construction. Bit (x - 1) of the mask is set when element x is in the
+     * second block; element 1 always stays in the first block.
+     *
+     * Example for n=4:
+     * @verbatim
+     *    mask (elements 4321)   moved
+     *    1000                   (initial)
+     *    1100                   3
+     *    1110                   2
+     *    0110                   4
+     *    ...
+     * @endverbatim
+     *
+     * Usage:
+     * @code
+     *    auto iter = ecgen::SetBipartIterator(n);
+     *    process(iter.mask());
+     *    while (iter.next()) {
+     *        process(iter.mask(), iter.element());
+     *    }
+     * @endcode
+     */
+    class SetBipartIterator {
+      public:
+        /**
+         * @brief Construct a new Set Bipart Iterator object
+         *
+         * The iterator starts at the initial bipartition {1,...,n-1}{n}.
+         *
+         * @param[in] n - The number of elements (3 <= n <= 64). Otherwise the
+         * sequence is empty.
+         */
+        explicit SetBipartIterator(int n);
+
+        /**
+         * @brief Advance to the next bipartition
+         *
+         * @return true if an element was moved, false once the sequence is
+         * exhausted.
+         */
+        auto next() -> bool;
+
+        /**
+         * @brief The element (1-based, as yielded by set_bipart_gen) moved by
+         * the last call to next()
+         */
+        auto element() const noexcept -> int { return this->_element; }
+
+        /**
+         * @brief The current bipartition as a bit mask of the second block
+         */
+        auto mask() const noexcept -> std::uint64_t { return this->_mask; }
+
+      private:
+        enum class Kind : std::uint8_t { gen0, gen1, neg1 };
+
+        struct Frame {
+            Kind kind;
+            std::uint8_t pc;
+            std::int8_t n;
+        };
+
+        auto _move(int x) noexcept -> bool {
+            this->_element = x;
+            this->_mask ^= std::uint64_t{1} << (x - 1);
+            return true;
+        }
+
+        void _call(Kind kind, int n) noexcept {
+            if (n >= 3) {
+                this->_stack[this->_top++] = Frame{kind, 0, static_cast<std::int8_t>(n)};
+            }
+        }
+
+        void _tail_call(Kind kind, int n) noexcept {
+            if (n >= 3) {
+                this->_stack[this->_top - 1] = Frame{kind, 0, static_cast<std::int8_t>(n)};
+            } else {
+                --this->_top;
+            }
+        }
+
+        std::array<Frame, 64> _stack{};
+        std::size_t _top{0};
+        std::uint64_t _mask{0};
+        int _element{0};
+    };
+
 }  // namespace ecgen
@@ -0,0 +1,208 @@
+/**
+ * @file set_bipart_parallel.hpp
+ * @brief Parallel sweep over all bipartitions with per-thread reducers
+ *
+ * The 2^(n-1) - 1 bipartitions of [n] are split into independent shards by
+ * fixing the blocks of the top elements. Each shard is a Gray-code run of
+ * SetBipartIterator over the remaining low elements, so a worker can keep
+ * incremental state while it walks its shard.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ecgen/set_bipart.hpp>
+#include <ecgen/work_stealing_pool.hpp>
+#include <type_traits>  // for invoke_result_t
+#include <utility>      // for move, pair
+#include <vector>
+
+namespace ecgen {
+
+    /**
+     * @brief Visit one shard of the bipartitions of [n]
+     *
+     * The shard consists of all bipartitions whose elements m+1, ..., n (with
+     * m = n - fixed) are placed according to `pattern`: bit i of `pattern`
+     * gives the block of element m+1+i. Successive visits differ by moving a
+     * single element, so `visit(mask, moved)` receives the moved element
+     * (1-based), or 0 for the first bipartition of the shard.
+     *
+     * Example for n=5, fixed=2, pattern=0b10 (element 5 in the second block):
+     * @verbatim
+     *    10000  (moved 0)
+     *    10100  (moved 3)
+     *    ...    (SetBipartIterator(3) moves)
+     * @endverbatim
+     *
+     * @tparam Visitor - callable as visit(std::uint64_t mask, int moved)
+     * @param[in] n - The number of elements (n <= 64).
+     * @param[in] fixed - The number of top elements with fixed blocks
+     * (n - fixed >= 3).
+     * @param[in] pattern - The blocks of the fixed elements.
+     * @param[in] visit - The visitor.
+     */
+    template <typename Visitor>
+    void set_bipart_shard(int n, int fixed, std::uint64_t pattern, Visitor&& visit) {
+        const int m = n - fixed;
+        const auto base = pattern << m;
+        auto iter = SetBipartIterator(m);
+        if (base != 0) {  // the low elements may all share the first block
+            visit(base, 0);
+            visit(base | iter.mask(), m);
+        } else {
+            visit(iter.mask(), 0);
+        }
+        while (iter.next()) {
+            visit(base | iter.mask(), iter.element());
+        }
+    }
+
+    /**
+     * @brief Sweep all bipartitions of [n] in parallel with per-thread reducers
+     *
+     * Every worker of the pool owns a reducer created by `make_reducer()`.
+     * The shards (see set_bipart_shard) are scheduled with
+     * pool.parallel_for, and each of their bipartitions is fed to the reducer
+     * of the worker running the shard as reducer(mask, moved). When all
+     * shards are done, the reducers are combined with reducer.merge(other)
+     * in worker order, so no synchronisation happens inside the sweep.
+     *
+     * @tparam Factory - callable returning a reducer
+     * @param[in] n - The number of elements (n <= 64).
+     * @param[in] make_reducer - The reducer factory.
+     * @param[in] pool - The pool to run on.
+     * @return The merged reducer.
+     */
+    template <typename Factory>
+    auto set_bipart_parallel_reduce(int n, Factory make_reducer, WorkStealingPool& pool)
+        -> std::invoke_result_t<Factory&> {
+        auto result = make_reducer();
+        if (n < 3) {
+            return result;
+        }
+
+        // about 16 shards per worker keeps the tail short
+        int fixed = 0;
+        while (fixed < n - 3 && (std::uint64_t{1} << fixed) < 16U * pool.num_workers()) {
+            ++fixed;
+        }
+        const auto num_shards = std::uint64_t{1} << fixed;
+
+        using Reducer = std::invoke_result_t<Factory&>;
+        auto reducers = std::vector<Reducer>{};
+        reducers.reserve(pool.num_workers());
+        for (auto i = 0U; i != pool.num_workers(); ++i) {
+            reducers.push_back(make_reducer());
+        }
+
+        pool.parallel_for(0, static_cast<std::size_t>(num_shards), [&](std::size_t pattern) {
+            auto& reducer = reducers[static_cast<std::size_t>(pool.worker_index())];
+            set_bipart_shard(n, fixed, static_cast<std::uint64_t>(pattern), reducer);
+        });
+
+        for (auto& reducer : reducers) {
+            result.merge(reducer);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Sweep all bipartitions of [n] in parallel with per-thread reducers
+     *
+     * Runs on a temporary WorkStealingPool (see the overload taking a pool).
+     *
+     * @tparam Factory - callable returning a reducer
+     * @param[in] n - The number of elements (n <= 64).
+     * @param[in] make_reducer - The reducer factory.
+     * @param[in] num_workers - The number of threads (0 means
+     * std::thread::hardware_concurrency()).
+     * @return The merged reducer.
+     */
+    template <typename Factory>
+    auto set_bipart_parallel_reduce(int n, Factory make_reducer, unsigned num_workers = 0)
+        -> std::invoke_result_t<Factory&> {
+        if (n < 3) {
+            return make_reducer();
+        }
+        auto pool = WorkStealingPool(num_workers);
+        return set_bipart_parallel_reduce(n, std::move(make_reducer), pool);
+    }
+
+    /**
+     * @brief Reducer keeping the bipartition with the minimum cost
+     *
+     * Ties are broken by the smaller mask, so the result does not depend on
+     * how the shards were scheduled.
+     *
+     * @tparam Cost - callable as cost(std::uint64_t mask)
+     */
+    template <typename Cost> class BipartMinReducer {
+      public:
+        using value_type = std::invoke_result_t<Cost&, std::uint64_t>;
+
+        /**
+         * @brief Construct a new Bipart Min Reducer object
+         *
+         * @param[in] cost - The cost function (copied per thread).
+         */
+        explicit BipartMinReducer(Cost cost) : _cost{std::move(cost)} {}
+
+        /**
+         * @brief Evaluate one bipartition
+         *
+         * @param[in] mask - The bipartition.
+         */
+        void operator()(std::uint64_t mask, int /* moved */) {
+            this->_update(this->_cost(mask), mask);
+        }
+
+        /**
+         * @brief Combine with the result of another worker
+         *
+         * @param[in] other - The other reducer.
+         */
+        void merge(const BipartMinReducer& other) {
+            if (other._found) {
+                this->_update(other._value, other._mask);
+            }
+        }
+
+        auto found() const noexcept -> bool { return this->_found; }
+        auto value() const noexcept -> const value_type& { return this->_value; }
+        auto mask() const noexcept -> std::uint64_t { return this->_mask; }
+
+      private:
+        void _update(const value_type& value, std::uint64_t mask) {
+            if (!this->_found || value < this->_value
+                || (!(this->_value < value) && mask < this->_mask)) {
+                this->_found = true;
+                this->_value = value;
+                this->_mask = mask;
+            }
+        }
+
+        Cost _cost;
+        value_type _value{};
+        std::uint64_t _mask{0};
+        bool _found{false};
+    };
+
+    /**
+     * @brief Find the bipartition of [n] with the minimum cost in parallel
+     *
+     * @tparam Cost - callable as cost(std::uint64_t mask)
+     * @param[in] n - The number of elements (3 <= n <= 64).
+     * @param[in] cost - The cost function; each worker uses its own copy.
+     * @param[in] num_workers - The number of threads (0 means all cores).
+     * @return The pair (minimum cost, mask of the second block).
+     */
+    template <typename Cost> auto set_bipart_min(int n, Cost cost, unsigned num_workers = 0)
+        -> std::pair<typename BipartMinReducer<Cost>::value_type, std::uint64_t> {
+        const auto best = set_bipart_parallel_reduce(
+            n, [&cost]() { return BipartMinReducer<Cost>(cost); }, num_workers);
+        return {best.value(), best.mask()};
+    }
+
+}  // namespace ecgen
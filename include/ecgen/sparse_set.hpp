@@ -0,0 +1,234 @@
+/**
+ * @file sparse_set.hpp
+ * @brief Sparse sets of small integers with O(1) add, remove, contains and clear
+ *
+ * The set keeps a permutation `dense` of 0 .. capacity-1 and its inverse
+ * `sparse`; the members are dense[0 .. size-1]. Because both arrays always
+ * hold a permutation, no entry is ever uninitialised: clear() just sets size
+ * to 0, and contains(x) is the single comparison sparse[x] < size.
+ *
+ * Erasing swaps the element to position size-1 before shrinking, so the
+ * erased elements stay in dense[size ..] in reverse order of removal. Hence
+ * restore(old_size) undoes every erase since size() was old_size, which is
+ * what backtracking searches need for their domains.
+ *
+ * Reference:
+ * P. Briggs, L. Torczon. An efficient representation for sparse sets.
+ * ACM Letters on Programming Languages and Systems 2 (1993), 59-69.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <numeric>  // for iota
+#include <type_traits>
+#include <utility>  // for move
+#include <vector>
+
+namespace ecgen {
+
+    namespace detail {
+        /**
+         * @brief Sparse set over a storage of two equally sized arrays
+         *
+         * @tparam IndexT - The unsigned type of the elements.
+         * @tparam Storage - std::array<IndexT, N> or std::vector<IndexT>.
+         */
+        template <typename IndexT, typename Storage> class BasicSparseSet {
+            static_assert(std::is_unsigned_v<IndexT>, "IndexT must be an unsigned integer type");
+
+          public:
+            using value_type = IndexT;
+            using size_type = std::size_t;
+            using const_iterator = const IndexT*;
+
+            auto size() const noexcept -> size_type { return this->_size; }
+            auto empty() const noexcept -> bool { return this->_size == 0; }
+            auto capacity() const noexcept -> size_type { return this->_dense.size(); }
+
+            /// Members in insertion order (as modified by erasures)
+            auto begin() const noexcept -> const_iterator { return this->_dense.data(); }
+            auto end() const noexcept -> const_iterator {
+                return this->_dense.data() + this->_size;
+            }
+
+            auto contains(IndexT x) const noexcept -> bool {
+                return this->_sparse[x] < this->_size;
+            }
+
+            /**
+             * @brief Add an element
+             *
+             * @param[in] x - The element (< capacity()).
+             * @return true if x was not a member.
+             */
+            auto insert(IndexT x) noexcept -> bool {
+                const auto pos = this->_sparse[x];
+                if (pos < this->_size) {
+                    return false;
+                }
+                this->_swap(pos, static_cast<IndexT>(this->_size));
+                ++this->_size;
+                return true;
+            }
+
+            /**
+             * @brief Remove an element
+             *
+             * @param[in] x - The element (< capacity()).
+             * @return true if x was a member.
+             */
+            auto erase(IndexT x) noexcept -> bool {
+                const auto pos = this->_sparse[x];
+                if (pos >= this->_size) {
+                    return false;
+                }
+                --this->_size;
+                this->_swap(pos, static_cast<IndexT>(this->_size));
+                return true;
+            }
+
+            /**
+             * @brief Remove every member except x in O(1)
+             *
+             * The other members stay behind size(), so restore() undoes it.
+             *
+             * @param[in] x - A member.
+             */
+            void keep_only(IndexT x) noexcept {
+                this->_swap(this->_sparse[x], IndexT{0});
+                this->_size = 1;
+            }
+
+            /// Remove all elements in O(1)
+            void clear() noexcept { this->_size = 0; }
+
+            /// Add all of 0 .. capacity()-1 in O(1)
+            void fill() noexcept { this->_size = this->capacity(); }
+
+            /**
+             * @brief Undo all erasures made since size() was `old_size`
+             *
+             * Only valid if no element was inserted in between.
+             *
+             * @param[in] old_size - A previous value of size().
+             */
+            void restore(size_type old_size) noexcept { this->_size = old_size; }
+
+            /**
+             * @brief Keep only the members satisfying `pred`
+             *
+             * @param[in] pred - callable as pred(IndexT)
+             * @return The number of removed elements.
+             */
+            template <typename Pred> auto erase_if(Pred&& pred) -> size_type {
+                const auto old_size = this->_size;
+                for (auto i = this->_size; i-- > 0;) {
+                    const auto x = this->_dense[i];
+                    if (pred(x)) {
+                        this->erase(x);
+                    }
+                }
+                return old_size - this->_size;
+            }
+
+            /**
+             * @brief Add a range of elements
+             *
+             * Each insertion is a dependent swap in the permutation, so the
+             * loop does not vectorise; it is branch-light instead.
+             *
+             * @param[in] first, last - The elements.
+             */
+            template <typename It> void insert(It first, It last) {
+                for (; first != last; ++first) {
+                    const auto x = static_cast<IndexT>(*first);
+                    const auto pos = this->_sparse[x];
+                    if (pos >= this->_size) {
+                        this->_swap(pos, static_cast<IndexT>(this->_size++));
+                    }
+                }
+            }
+
+            /**
+             * @brief Add all members of another set (of any storage)
+             *
+             * @param[in] other - The other set.
+             */
+            template <typename OtherStorage>
+            void merge(const BasicSparseSet<IndexT, OtherStorage>& other) {
+                this->insert(other.begin(), other.end());
+            }
+
+          protected:
+            BasicSparseSet() = default;
+            explicit BasicSparseSet(Storage storage)
+                : _dense{storage}, _sparse{std::move(storage)} {}
+
+            void _init() {
+                std::iota(this->_dense.begin(), this->_dense.end(), IndexT{0});
+                std::iota(this->_sparse.begin(), this->_sparse.end(), IndexT{0});
+            }
+
+          private:
+            void _swap(IndexT i, IndexT j) noexcept {
+                const auto x = this->_dense[i];
+                const auto y = this->_dense[j];
+                this->_dense[i] = y;
+                this->_dense[j] = x;
+                this->_sparse[x] = j;
+                this->_sparse[y] = i;
+            }
+
+            Storage _dense{};
+            Storage _sparse{};
+            size_type _size{0};
+        };
+    }  // namespace detail
+
+    /**
+     * @brief Sparse set of the integers 0 .. Capacity-1 with inline storage
+     *
+     * Example:
+     * @code
+     *    auto set = ecgen::SparseSet<std::uint8_t, 200>{};
+     *    set.insert(3);
+     *    set.insert(7);
+     *    set.erase(3);  // set == {7}
+     * @endcode
+     *
+     * @tparam IndexT - The unsigned element type.
+     * @tparam Capacity - The number of possible elements.
+     */
+    template <typename IndexT, std::size_t Capacity> class SparseSet
+        : public detail::BasicSparseSet<IndexT, std::array<IndexT, Capacity>> {
+        static_assert(Capacity == 0 || Capacity - 1 <= std::size_t(IndexT(~IndexT{0})),
+                      "IndexT cannot represent all elements");
+
+      public:
+        /// An empty set
+        SparseSet() { this->_init(); }
+    };
+
+    /**
+     * @brief Sparse set of the integers 0 .. capacity-1 with heap storage
+     *
+     * @tparam IndexT - The unsigned element type.
+     */
+    template <typename IndexT> class DynamicSparseSet
+        : public detail::BasicSparseSet<IndexT, std::vector<IndexT>> {
+      public:
+        /**
+         * @brief An empty set
+         *
+         * @param[in] capacity - The number of possible elements (at most
+         * the largest IndexT plus one).
+         */
+        explicit DynamicSparseSet(std::size_t capacity)
+            : detail::BasicSparseSet<IndexT, std::vector<IndexT>>(std::vector<IndexT>(capacity)) {
+            this->_init();
+        }
+    };
+
+}  // namespace ecgen
@@ -0,0 +1,47 @@
+/**
+ * @file step_iterator.hpp
+ * @brief Range-for support for the loopless generators
+ *
+ * A loopless generator holds its current object and advances in place with
+ * next(), so its iterator carries nothing but a pointer to the generator
+ * and an end flag. The generators share this one class template.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>  // for default_sentinel_t
+
+namespace ecgen {
+
+    /**
+     * @brief Steps a generator with empty() and next(); dereferences to the generator
+     *
+     * Example:
+     * @code
+     *    auto begin() -> StepIterator<Gen> { return StepIterator<Gen>{this}; }
+     *    auto end() const noexcept -> std::default_sentinel_t { return {}; }
+     * @endcode
+     */
+    template <typename Gen> class StepIterator {
+      public:
+        using value_type = Gen;
+        using difference_type = std::ptrdiff_t;
+
+        StepIterator() = default;
+        explicit StepIterator(Gen* gen) : _gen{gen}, _done{gen->empty()} {}
+
+        auto operator*() const -> const Gen& { return *this->_gen; }
+        auto operator++() -> StepIterator& {
+            this->_done = !this->_gen->next();
+            return *this;
+        }
+        void operator++(int) { ++*this; }
+        auto operator==(std::default_sentinel_t) const -> bool { return this->_done; }
+
+      private:
+        Gen* _gen{nullptr};
+        bool _done{true};
+    };
+
+}  // namespace ecgen
@@ -0,0 +1,306 @@
+/**
+ * @file tour_cost.hpp
+ * @brief Exhaustive tour and path costs over an adjacent-transposition stream
+ *
+ * Consecutive permutations of the SJT order differ by swapping positions i
+ * and i+1. Of the edges of a path or tour only three are affected:
+ * @verbatim
+ *    ... p -> a -> b -> q ...   becomes   ... p -> b -> a -> q ...
+ * @endverbatim
+ * so the cost of every permutation follows from the previous one in O(1),
+ * for any (also asymmetric) distance matrix.
+ *
+ * Tours (closed = true) keep city 0 in front and permute the others, giving
+ * each cyclic tour exactly once per direction. Paths (closed = false)
+ * permute all n cities.
+ *
+ * For floating-point costs the running sum is recomputed from scratch every
+ * 4096 steps so that rounding errors do not pile up over n! additions.
+ */
+
+#pragma once
+
+#include <algorithm>  // for push_heap, pop_heap, sort_heap, rotate
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <ecgen/perm.hpp>
+#include <ecgen/work_stealing_pool.hpp>
+#include <numeric>  // for iota
+#include <span>
+#include <type_traits>
+#include <utility>  // for swap, move
+#include <vector>
+
+namespace ecgen {
+
+    /// The cost type of a distance matrix indexed as dist[i][j]
+    template <typename Matrix> using TourCost
+        = std::remove_cvref_t<decltype(std::declval<const Matrix&>()[0][0])>;
+
+    /// A permutation with its cost
+    template <typename Cost> struct Tour {
+        Cost cost;
+        std::vector<int> order;
+    };
+
+    namespace detail {
+        template <typename Matrix> inline auto edge(const Matrix& dist, int from, int to)
+            -> TourCost<Matrix> {
+            return dist[static_cast<std::size_t>(from)][static_cast<std::size_t>(to)];
+        }
+    }  // namespace detail
+
+    /**
+     * @brief The cost of a path or tour
+     *
+     * @param[in] dist - The distance matrix, indexed as dist[from][to].
+     * @param[in] perm - The order of the cities.
+     * @param[in] closed - Whether to add the edge back to perm[0].
+     * @return The sum of the edge costs.
+     */
+    template <typename Matrix>
+    inline auto tour_cost(const Matrix& dist, std::span<const int> perm, bool closed = true)
+        -> TourCost<Matrix> {
+        auto cost = TourCost<Matrix>{};
+        for (std::size_t i = 1; i < perm.size(); ++i) {
+            cost += detail::edge(dist, perm[i - 1], perm[i]);
+        }
+        if (closed && perm.size() > 1) {
+            cost += detail::edge(dist, perm.back(), perm.front());
+        }
+        return cost;
+    }
+
+    namespace detail {
+        /**
+         * @brief Visit the permutations of perm[start ..] with their costs
+         *
+         * perm[0 .. start-1] stays fixed. `stop` (may be null) is polled every
+         * 4096 steps and set when `callback` returns false.
+         */
+        template <typename Matrix, typename Callback>
+        auto sweep_suffix(const Matrix& dist, std::vector<int>& perm, int start, bool closed,
+                          Callback& callback, std::atomic<bool>* stop) -> bool {
+            const auto n = int(perm.size());
+            auto cost = tour_cost(dist, std::span<const int>(perm), closed);
+            if (!callback(std::span<const int>(perm), cost)) {
+                if (stop != nullptr) {
+                    stop->store(true, std::memory_order_relaxed);
+                }
+                return false;
+            }
+            auto sjt = SjtIndex(n - start);
+            for (std::uint32_t step = 1;; ++step) {
+                const auto idx = sjt.next();
+                if (idx < 0) {
+                    return true;
+                }
+                const auto i = static_cast<std::size_t>(start + idx);
+                const auto a = perm[i];
+                const auto b = perm[i + 1];
+                cost += edge(dist, b, a) - edge(dist, a, b);
+                if (i > 0) {
+                    const auto p = perm[i - 1];
+                    cost += edge(dist, p, b) - edge(dist, p, a);
+                }
+                if (i + 2 < perm.size() || closed) {
+                    const auto q = i + 2 < perm.size() ? perm[i + 2] : perm[0];
+                    cost += edge(dist, a, q) - edge(dist, b, q);
+                }
+                perm[i] = b;
+                perm[i + 1] = a;
+                if ((step & 4095U) == 0) {
+                    if constexpr (std::is_floating_point_v<TourCost<Matrix>>) {
+                        cost = tour_cost(dist, std::span<const int>(perm), closed);
+                    }
+                    if (stop != nullptr && stop->load(std::memory_order_relaxed)) {
+                        return false;
+                    }
+                }
+                if (!callback(std::span<const int>(perm), cost)) {
+                    if (stop != nullptr) {
+                        stop->store(true, std::memory_order_relaxed);
+                    }
+                    return false;
+                }
+            }
+        }
+
+        /// Keeps the k cheapest tours in a max-heap
+        template <typename Cost> class TopTours {
+          public:
+            explicit TopTours(std::size_t k) : _k{k} {}
+
+            template <typename Matrix>
+            void offer(const Matrix& dist, std::span<const int> perm, Cost cost, bool closed) {
+                // equal costs go on to _push(), which breaks ties by the order
+                if (this->_k == 0
+                    || (this->_heap.size() == this->_k && this->_heap.front().cost < cost)) {
+                    return;
+                }
+                // the running cost may carry rounding errors; store the exact one
+                this->_push(Tour<Cost>{tour_cost(dist, perm, closed),
+                                       std::vector<int>(perm.begin(), perm.end())});
+            }
+
+            void merge(TopTours&& other) {
+                for (auto& tour : other._heap) {
+                    this->_push(std::move(tour));
+                }
+                other._heap.clear();
+            }
+
+            /// The kept tours, cheapest first
+            auto take() -> std::vector<Tour<Cost>> {
+                std::sort_heap(this->_heap.begin(), this->_heap.end(), worse);
+                return std::move(this->_heap);
+            }
+
+          private:
+            static auto worse(const Tour<Cost>& lhs, const Tour<Cost>& rhs) -> bool {
+                return lhs.cost < rhs.cost || (!(rhs.cost < lhs.cost) && lhs.order < rhs.order);
+            }
+
+            void _push(Tour<Cost>&& tour) {
+                if (this->_heap.size() == this->_k) {
+                    if (!worse(tour, this->_heap.front())) {
+                        return;
+                    }
+                    std::pop_heap(this->_heap.begin(), this->_heap.end(), worse);
+                    this->_heap.pop_back();
+                }
+                this->_heap.push_back(std::move(tour));
+                std::push_heap(this->_heap.begin(), this->_heap.end(), worse);
+            }
+
+            std::size_t _k;
+            std::vector<Tour<Cost>> _heap;  ///< max-heap, the worst kept tour in front
+        };
+
+        /// Extend the fixed prefix perm[0 .. level-1] by one position in all
+        /// ways, keeping the rest of each shard in increasing order
+        inline void tour_shards(std::vector<int>& perm, int level,
+                                std::vector<std::vector<int>>& shards) {
+            const auto pos = static_cast<std::ptrdiff_t>(level);
+            for (auto i = pos; i != static_cast<std::ptrdiff_t>(perm.size()); ++i) {
+                auto& shard = shards.emplace_back(perm);
+                // bring perm[i] to the front, keeping the rest in order
+                std::rotate(shard.begin() + pos, shard.begin() + i, shard.begin() + i + 1);
+            }
+        }
+    }  // namespace detail
+
+    /**
+     * @brief Visit every tour (or path) of n cities with its cost
+     *
+     * Example (count the tours cheaper than a limit):
+     * @code
+     *    auto count = 0;
+     *    ecgen::tour_cost_sweep(dist, n, [&](std::span<const int>, int cost) {
+     *        count += cost < limit;
+     *        return true;
+     *    });
+     * @endcode
+     *
+     * @param[in] dist - The distance matrix, indexed as dist[from][to].
+     * @param[in] n - The number of cities.
+     * @param[in] callback - called as bool(std::span<const int> perm, cost);
+     * the view is valid during the call only, false stops the sweep.
+     * @param[in] closed - Tours through city 0 (true) or open paths (false).
+     * @return false if the sweep was stopped by `callback`.
+     */
+    template <typename Matrix, typename Callback>
+    auto tour_cost_sweep(const Matrix& dist, int n, Callback&& callback, bool closed = true)
+        -> bool {
+        if (n < 1) {
+            return true;
+        }
+        auto perm = std::vector<int>(static_cast<std::size_t>(n));
+        std::iota(perm.begin(), perm.end(), 0);
+        return detail::sweep_suffix(dist, perm, closed ? 1 : 0, closed, callback, nullptr);
+    }
+
+    /**
+     * @brief Visit every tour (or path) on a pool
+     *
+     * The leading positions are fixed in all possible ways, at the smallest
+     * depth that gives about 16 shards per worker, and every shard is swept
+     * as an independent SJT stream. `callback` is called concurrently and
+     * must be thread-safe; after it returns false the other shards stop
+     * within 4096 steps.
+     *
+     * @param[in] pool - The pool.
+     * @return false if the sweep was stopped by `callback`.
+     */
+    template <typename Matrix, typename Callback>
+    auto tour_cost_sweep(WorkStealingPool& pool, const Matrix& dist, int n, Callback&& callback,
+                         bool closed = true) -> bool {
+        const auto start = closed ? 1 : 0;
+        if (n - start < 3) {
+            return tour_cost_sweep(dist, n, callback, closed);
+        }
+        auto perm = std::vector<int>(static_cast<std::size_t>(n));
+        std::iota(perm.begin(), perm.end(), 0);
+        auto shards = std::vector<std::vector<int>>{};
+        shards.push_back(std::move(perm));
+        const auto depth = split_frontier(pool, shards, start, n - 2, detail::tour_shards);
+        auto stop = std::atomic<bool>{false};
+        pool.parallel_for(0, shards.size(), [&](std::size_t i) {
+            if (!stop.load(std::memory_order_relaxed)) {
+                detail::sweep_suffix(dist, shards[i], depth, closed, callback, &stop);
+            }
+        });
+        return !stop.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief The k cheapest tours (or paths) of n cities, cheapest first
+     *
+     * @param[in] dist - The distance matrix, indexed as dist[from][to].
+     * @param[in] n - The number of cities.
+     * @param[in] k - The number of tours to keep.
+     * @param[in] closed - Tours through city 0 (true) or open paths (false).
+     * @return At most k tours with their exact costs.
+     */
+    template <typename Matrix>
+    auto tour_cost_top_k(const Matrix& dist, int n, std::size_t k, bool closed = true)
+        -> std::vector<Tour<TourCost<Matrix>>> {
+        auto top = detail::TopTours<TourCost<Matrix>>(k);
+        tour_cost_sweep(
+            dist, n,
+            [&](std::span<const int> perm, TourCost<Matrix> cost) {
+                top.offer(dist, perm, cost, closed);
+                return true;
+            },
+            closed);
+        return top.take();
+    }
+
+    /**
+     * @brief The k cheapest tours (or paths) of n cities, searched on a pool
+     *
+     * Every worker keeps its own k best, merged at the end.
+     */
+    template <typename Matrix>
+    auto tour_cost_top_k(WorkStealingPool& pool, const Matrix& dist, int n, std::size_t k,
+                         bool closed = true) -> std::vector<Tour<TourCost<Matrix>>> {
+        auto tops = std::vector<detail::TopTours<TourCost<Matrix>>>(
+            pool.num_workers(), detail::TopTours<TourCost<Matrix>>(k));
+        tour_cost_sweep(
+            pool, dist, n,
+            [&](std::span<const int> perm, TourCost<Matrix> cost) {
+                // small instances are swept on the calling thread
+                const auto slot = pool.worker_index();
+                tops[static_cast<std::size_t>(slot < 0 ? 0 : slot)].offer(dist, perm, cost,
+                                                                          closed);
+                return true;
+            },
+            closed);
+        for (std::size_t i = 1; i < tops.size(); ++i) {
+            tops[0].merge(std::move(tops[i]));
+        }
+        return tops[0].take();
+    }
+
+}  // namespace ecgen
@@ -0,0 +1,135 @@
+/**
+ * @file transition_cache.hpp
+ * @brief Precomputed transition sequences kept in memory-mapped files
+ *
+ * Some (n, k) pairs are enumerated over and over. A TransitionTable runs
+ * the generator once, stores its moves as byte pairs in a cache directory,
+ * and on later loads just maps the file: enumeration becomes a sequential
+ * scan of read-only pages that all processes on the machine share.
+ *
+ * A table is written to a temporary file and renamed into place, so
+ * concurrent loaders never see a partial file; at worst several of them
+ * build the same table and the last rename wins.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ecgen/mapped_file.hpp>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <utility>  // for move, pair
+
+namespace ecgen {
+
+    /// The generator a table caches
+    enum class TransitionKind : std::uint32_t {
+        emk_comb,       ///< emk_comb_gen(n, k): swapped positions (x, y)
+        set_partition,  ///< set_partition_gen(n, k): element x (from 1) moves to block y
+    };
+
+    /**
+     * @brief The moves of a generator, read from a mapped cache file
+     *
+     * Example:
+     * @code
+     *    auto table = ecgen::TransitionTable::load("/var/cache/ecgen",
+     *                                              ecgen::TransitionKind::emk_comb, 30, 8);
+     *    for (const auto& [x, y] : *table) {  // same moves as emk_comb_gen(30, 8)
+     *        std::swap(lst[x], lst[y]);
+     *    }
+     * @endcode
+     */
+    class TransitionTable {
+      public:
+        /// Iterates the stored moves as std::pair<int, int>
+        class const_iterator {
+          public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = std::pair<int, int>;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = value_type;
+
+            const_iterator() = default;
+            explicit const_iterator(const std::byte* pos) : _pos{pos} {}
+
+            auto operator*() const -> value_type {
+                return {std::to_integer<int>(this->_pos[0]), std::to_integer<int>(this->_pos[1])};
+            }
+            auto operator++() -> const_iterator& {
+                this->_pos += 2;
+                return *this;
+            }
+            auto operator++(int) -> const_iterator {
+                auto old = *this;
+                this->_pos += 2;
+                return old;
+            }
+            auto operator==(const const_iterator& other) const -> bool = default;
+
+          private:
+            const std::byte* _pos{nullptr};
+        };
+
+        /**
+         * @brief Map the table for (kind, n, k), building it first if needed
+         *
+         * A missing or invalid file in `cache_dir` is (re)built.
+         *
+         * @param[in] cache_dir - An existing directory.
+         * @param[in] kind - The generator.
+         * @param[in] n - The number of elements (below 256).
+         * @param[in] k - The size of the combinations, or the number of blocks.
+         * @return std::nullopt if the arguments are out of range or the file
+         * cannot be written or read.
+         */
+        static auto load(const std::string& cache_dir, TransitionKind kind, int n, int k)
+            -> std::optional<TransitionTable>;
+
+        /**
+         * @brief Run the generator and write its table to `path`
+         *
+         * @return false if the arguments are out of range or on an I/O error.
+         */
+        static auto build(const std::string& path, TransitionKind kind, int n, int k) -> bool;
+
+        /// The file name of a table inside the cache directory
+        static auto file_name(TransitionKind kind, int n, int k) -> std::string;
+
+        auto kind() const noexcept -> TransitionKind { return this->_kind; }
+        auto n() const noexcept -> int { return this->_n; }
+        auto k() const noexcept -> int { return this->_k; }
+
+        /// The number of moves
+        auto size() const noexcept -> std::size_t { return this->_size; }
+
+        auto begin() const noexcept -> const_iterator { return const_iterator{this->_moves}; }
+        auto end() const noexcept -> const_iterator {
+            return const_iterator{this->_moves + 2 * this->_size};
+        }
+
+        auto operator[](std::size_t i) const -> std::pair<int, int> {
+            return *const_iterator{this->_moves + 2 * i};
+        }
+
+        /// Whether the moves are mapped (shared) rather than copied into memory
+        auto is_mapped() const noexcept -> bool { return this->_file.is_mapped(); }
+
+      private:
+        explicit TransitionTable(MappedFile file) : _file{std::move(file)} {}
+
+        static auto _open(const std::string& path, TransitionKind kind, int n, int k)
+            -> std::optional<TransitionTable>;
+
+        MappedFile _file;
+        TransitionKind _kind{TransitionKind::emk_comb};
+        int _n{0};
+        int _k{0};
+        const std::byte* _moves{nullptr};
+        std::size_t _size{0};
+    };
+
+}  // namespace ecgen
@@ -0,0 +1,298 @@
+/**
+ * @file work_stealing_pool.hpp
+ * @brief Work-stealing thread pool with fork/join for the parallel drivers
+ *
+ * Every worker owns a Chase-Lev deque. join(f1, f2) pushes f2 onto the
+ * deque of the calling worker, runs f1 itself and then either pops f2 back
+ * or, if an idle worker stole it in the meantime, helps with other tasks
+ * until f2 is done. Tasks live in the stack frame of the join that created
+ * them, so forking does not allocate.
+ *
+ * Reference:
+ * N. M. Le, A. Pop, A. Cohen, F. Zappa Nardelli. Correct and efficient
+ * work-stealing for weak memory models. PPoPP 2013.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>  // for exception_ptr
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>  // for remove_reference_t
+#include <vector>
+
+namespace ecgen {
+
+    /**
+     * @brief A unit of work scheduled on a WorkStealingPool
+     *
+     * The callable is not copied: the task refers to it, and both live on the
+     * stack of the code that waits for the task.
+     */
+    class PoolTask {
+      public:
+        template <typename Fn> explicit PoolTask(Fn& fn)
+            : _fn{static_cast<void*>(&fn)},
+              _invoke{[](void* p) { (*static_cast<std::remove_reference_t<Fn>*>(p))(); }} {}
+
+        PoolTask(const PoolTask&) = delete;
+        auto operator=(const PoolTask&) -> PoolTask& = delete;
+
+        /// The waiting side may destroy the task as soon as done() is true.
+        void execute() noexcept {
+            try {
+                this->_invoke(this->_fn);
+            } catch (...) {
+                this->_error = std::current_exception();
+            }
+            this->_done.store(true, std::memory_order_release);
+        }
+
+        auto done() const noexcept -> bool { return this->_done.load(std::memory_order_acquire); }
+
+        /// Rethrow the exception the callable exited with, if any (after done()).
+        void rethrow() const {
+            if (this->_error) {
+                std::rethrow_exception(this->_error);
+            }
+        }
+
+      private:
+        void* _fn;
+        void (*_invoke)(void*);
+        std::exception_ptr _error;
+        std::atomic<bool> _done{false};
+    };
+
+    /**
+     * @brief Chase-Lev work-stealing deque of task pointers
+     *
+     * The owner pushes and pops at the bottom; other threads steal from the
+     * top. The ring buffer doubles when full; retired buffers are kept until
+     * the deque is destroyed, since a thief may still be reading them.
+     */
+    class WorkStealingDeque {
+      public:
+        explicit WorkStealingDeque(std::int64_t capacity = 256);
+
+        void push(PoolTask* task);         ///< owner only
+        auto pop() -> PoolTask*;           ///< owner only; nullptr if empty
+        auto steal() -> PoolTask*;         ///< any thread; nullptr if empty or lost a race
+        auto empty() const noexcept -> bool;
+
+      private:
+        struct Ring {
+            std::int64_t mask;
+            std::unique_ptr<std::atomic<PoolTask*>[]> slots;
+
+            explicit Ring(std::int64_t capacity);
+            auto capacity() const noexcept -> std::int64_t { return this->mask + 1; }
+            auto get(std::int64_t i) const noexcept -> PoolTask* {
+                return this->slots[static_cast<std::size_t>(i & this->mask)].load(
+                    std::memory_order_relaxed);
+            }
+            void put(std::int64_t i, PoolTask* task) noexcept {
+                this->slots[static_cast<std::size_t>(i & this->mask)].store(
+                    task, std::memory_order_relaxed);
+            }
+        };
+
+        alignas(64) std::atomic<std::int64_t> _top{0};
+        alignas(64) std::atomic<std::int64_t> _bottom{0};
+        std::atomic<Ring*> _ring;
+        std::vector<std::unique_ptr<Ring>> _rings;  ///< current and retired buffers
+    };
+
+    /**
+     * @brief Work-stealing executor shared by the parallel enumeration drivers
+     *
+     * Example:
+     * @code
+     *    auto pool = ecgen::WorkStealingPool(4);
+     *    auto sums = std::vector<long>(pool.num_workers());
+     *    pool.parallel_for(0, 1000, [&](std::size_t i) {
+     *        sums[static_cast<std::size_t>(pool.worker_index())] += long(i);
+     *    });
+     * @endcode
+     *
+     * Calls from outside the pool block until the work is done; calls from a
+     * worker of the pool run as nested fork/join inside the pool.
+     */
+    class WorkStealingPool {
+      public:
+        /**
+         * @brief Construct a new Work Stealing Pool object
+         *
+         * @param[in] num_workers - The number of threads (0 means
+         * std::thread::hardware_concurrency()).
+         */
+        explicit WorkStealingPool(unsigned num_workers = 0);
+        ~WorkStealingPool();
+
+        WorkStealingPool(const WorkStealingPool&) = delete;
+        auto operator=(const WorkStealingPool&) -> WorkStealingPool& = delete;
+
+        auto num_workers() const noexcept -> unsigned {
+            return static_cast<unsigned>(this->_deques.size());
+        }
+
+        /**
+         * @brief Index of the calling worker thread
+         *
+         * @return 0 .. num_workers() - 1, or -1 if the caller is not a worker
+         * of this pool.
+         */
+        auto worker_index() const noexcept -> int;
+
+        /**
+         * @brief Run fn() on the pool and wait for it
+         *
+         * An exception thrown by fn() is rethrown here once it has finished.
+         *
+         * @param[in] fn - The callable; it may call join() and parallel_for().
+         */
+        template <typename Fn> void run(Fn&& fn) {
+            if (this->worker_index() >= 0) {
+                fn();
+                return;
+            }
+            auto task = PoolTask(fn);
+            this->_submit(task);
+            this->_wait_root(task);
+            task.rethrow();
+        }
+
+        /**
+         * @brief Run fn1() and fn2() in parallel and wait for both
+         *
+         * If either throws, the exception is rethrown after fn2() has been
+         * taken back or has finished (fn1's first). fn2() is skipped if fn1()
+         * threw and nobody had stolen it yet.
+         *
+         * @param[in] fn1 - Runs on the calling thread.
+         * @param[in] fn2 - Offered to other workers.
+         */
+        template <typename Fn1, typename Fn2> void join(Fn1&& fn1, Fn2&& fn2) {
+            const auto index = this->worker_index();
+            if (index < 0) {
+                this->run([&]() { this->join(fn1, fn2); });
+                return;
+            }
+            auto& deque = *this->_deques[static_cast<std::size_t>(index)];
+            auto task = PoolTask(fn2);
+            deque.push(&task);
+            this->_wake();
+            auto error = std::exception_ptr{};
+            try {
+                fn1();
+            } catch (...) {
+                error = std::current_exception();
+            }
+            // thieves take the oldest task first, so if `task` is gone, the
+            // deque holds nothing of this join any more
+            if (deque.pop() == &task) {
+                if (!error) {
+                    task.execute();
+                }
+            } else {
+                this->_help_until(task, static_cast<std::size_t>(index));
+            }
+            if (error) {
+                std::rethrow_exception(error);
+            }
+            task.rethrow();
+        }
+
+        /**
+         * @brief Call fn(i) for every i in [first, last) in parallel
+         *
+         * The range is split in halves with join() down to `grain` indices.
+         *
+         * @param[in] first - The first index.
+         * @param[in] last - One past the last index.
+         * @param[in] fn - The loop body.
+         * @param[in] grain - The largest range run sequentially.
+         */
+        template <typename Fn>
+        void parallel_for(std::size_t first, std::size_t last, Fn&& fn, std::size_t grain = 1) {
+            if (first >= last) {
+                return;
+            }
+            this->run([&]() { this->_split(first, last, fn, grain == 0 ? 1 : grain); });
+        }
+
+      private:
+        template <typename Fn>
+        void _split(std::size_t first, std::size_t last, Fn& fn, std::size_t grain) {
+            if (last - first > grain) {
+                const auto middle = first + (last - first) / 2;
+                this->join([&]() { this->_split(first, middle, fn, grain); },
+                           [&]() { this->_split(middle, last, fn, grain); });
+                return;
+            }
+            for (auto i = first; i != last; ++i) {
+                fn(i);
+            }
+        }
+
+        void _submit(PoolTask& task);
+        void _wait_root(const PoolTask& task);
+        auto _run_injected() -> bool;
+        void _wake();
+        void _help_until(const PoolTask& task, std::size_t index);
+        auto _find_task(std::size_t index) -> PoolTask*;
+        void _worker_loop(std::size_t index);
+
+        std::vector<std::unique_ptr<WorkStealingDeque>> _deques;
+        std::vector<std::thread> _threads;
+        std::mutex _mutex;
+        std::condition_variable _cv;       ///< idle workers
+        std::condition_variable _done_cv;  ///< outside threads waiting in run()
+        std::deque<PoolTask*> _injected;            ///< tasks from outside threads
+        std::atomic<std::size_t> _num_injected{0};  ///< size of `_injected`
+        std::atomic<int> _num_sleeping{0};
+        std::atomic<std::uint64_t> _signal{0};  ///< bumped whenever work is published
+        bool _stop{false};
+    };
+
+    /**
+     * @brief Split a search tree into about 16 subtrees per worker of a pool
+     *
+     * Replaces every task of `frontier` by its children, one level at a
+     * time, until there are 16 tasks per worker or the frontier reaches
+     * `max_depth`. Each level is grown from the one before, so every node
+     * above the final frontier is expanded once; a few large branches near
+     * the root then no longer dominate the running time.
+     *
+     * @param[in] pool - The pool the subtrees will run on.
+     * @param[in,out] frontier - The tasks at `depth` on entry, the subtrees
+     * on return.
+     * @param[in] depth - The depth of the tasks on entry.
+     * @param[in] max_depth - The deepest split allowed.
+     * @param[in] expand - callable as void(Task&, int depth, std::vector<Task>&),
+     * appending the children of a task at `depth`.
+     * @return The depth of the subtrees.
+     */
+    template <typename Task, typename Expand>
+    auto split_frontier(const WorkStealingPool& pool, std::vector<Task>& frontier, int depth,
+                        int max_depth, Expand&& expand) -> int {
+        const auto target = std::size_t{16} * pool.num_workers();
+        auto children = std::vector<Task>{};
+        while (depth < max_depth && !frontier.empty() && frontier.size() < target) {
+            children.clear();
+            for (auto& task : frontier) {
+                expand(task, depth, children);
+            }
+            frontier.swap(children);
+            ++depth;
+        }
+        return depth;
+    }
+
+}  // namespace ecgen
@@ -163,6 +163,7 @@ namespace ecgen {
             for (int idx = 0; idx != n - 1; ++idx) {
                 co_yield std::make_pair(idx, idx + 1);
             }
+            co_return;
         }
         if (k % 2 == 0) {
             co_yield emk_gen_even(n, k);
@@ -0,0 +1,88 @@
+#include <algorithm>  // for max, min
+#include <ecgen/combin_range.hpp>
+#include <vector>
+
+namespace ecgen {
+    using ret_t = std::pair<int, int>;
+
+    /**
+     * @brief Generate all subsets of size k1..k2 in minimal-change order
+     *
+     * Walks the tree of the binary reflected Gray code, deciding element
+     * n-1 first and element 0 last. In forward direction a node visits the
+     * child "element absent" before "element present"; in reverse direction
+     * the order is swapped. Either way the first child is walked forward and
+     * the second one in reverse. Subtrees that cannot contain a subset whose
+     * size lies in [k1, k2] are skipped, so every node visited lies above at
+     * least one reported subset.
+     *
+     * At a leaf only the elements decided below the highest node touched
+     * since the previous leaf can differ, so the delta is found by comparing
+     * that part of the path.
+     *
+     * @param[in] n The number of elements in the full set.
+     * @param[in] k1 The minimum subset size.
+     * @param[in] k2 The maximum subset size.
+     * @return py::Generator<ret_t>
+     */
+    auto comb_range_gen(int n, int k1, int k2) -> py::Generator<ret_t> {
+        k1 = std::max(k1, 0);
+        k2 = std::min(k2, n);
+        if (n <= 0 || k1 > k2) {
+            co_return;
+        }
+        const auto size = static_cast<size_t>(n);
+        auto bits = std::vector<int>(size, 0);     // path of the current walk
+        auto current = std::vector<int>(size, 0);  // last reported subset
+        auto dirs = std::vector<int>(size + 1, 0);
+        auto stages = std::vector<int>(size + 1, 0);  // children tried so far
+        auto weights = std::vector<int>(size + 1, 0);
+        for (int idx = 0; idx != k1; ++idx) {
+            current[static_cast<size_t>(idx)] = 1;
+        }
+
+        auto first = true;
+        auto top = 0;  // shallowest depth changed since the last leaf
+        auto depth = 0;
+        while (depth >= 0) {
+            const auto d = static_cast<size_t>(depth);
+            if (depth == n) {
+                if (first) {
+                    first = false;  // always {0, ..., k1-1}
+                } else {
+                    auto removed = -1;
+                    auto added = -1;
+                    for (int pos = n - 1 - top; pos >= 0; --pos) {
+                        const auto p = static_cast<size_t>(pos);
+                        if (bits[p] != current[p]) {
+                            current[p] = bits[p];
+                            (bits[p] != 0 ? added : removed) = pos;
+                        }
+                    }
+                    co_yield std::make_pair(removed, added);
+                }
+                top = n;
+                --depth;
+                continue;
+            }
+            if (stages[d] == 2) {
+                --depth;
+                continue;
+            }
+            const auto bit = stages[d] == 0 ? dirs[d] : 1 - dirs[d];
+            const auto child_dir = stages[d];
+            ++stages[d];
+            const auto weight = weights[d] + bit;
+            if (weight > k2 || weight + (n - depth - 1) < k1) {
+                continue;  // no subset of the right size below
+            }
+            bits[size - 1 - d] = bit;
+            top = std::min(top, depth);
+            weights[d + 1] = weight;
+            dirs[d + 1] = child_dir;
+            stages[d + 1] = 0;
+            ++depth;
+        }
+    }
+
+}  // namespace ecgen
@@ -0,0 +1,196 @@
+#include <algorithm>  // for min, copy_n, fill
+#include <cstddef>
+#include <cstdint>
+#include <ecgen/de_bruijn.hpp>
+#include <limits>
+#include <span>
+#include <utility>  // for pair
+#include <vector>
+
+namespace ecgen {
+
+    namespace {
+        /// k^n, or 0 if it does not fit in 64 bits
+        auto power(int k, int n) -> std::uint64_t {
+            auto result = std::uint64_t{1};
+            for (auto i = 0; i != n; ++i) {
+                if (result > std::numeric_limits<std::uint64_t>::max() / std::uint64_t(k)) {
+                    return 0;
+                }
+                result *= std::uint64_t(k);
+            }
+            return result;
+        }
+    }  // namespace
+
+    DeBruijnStream::DeBruijnStream(int k, int n) : _k{k}, _n{n} {
+        if (k < 2 || k > 256 || n < 1) {
+            return;
+        }
+        this->_length = power(k, n);
+        if (this->_length == 0) {
+            return;
+        }
+        this->_a.assign(static_cast<std::size_t>(n) + 1, 0);  // 0^n, p = 1
+    }
+
+    auto DeBruijnStream::read(std::span<std::uint8_t> out) -> std::size_t {
+        auto count = std::size_t{0};
+        while (count < out.size() && this->_pos + count < this->_length) {
+            if (this->_offset == this->_p && !this->_advance()) {
+                break;
+            }
+            const auto left = static_cast<std::size_t>(this->_p - this->_offset);
+            const auto m = std::min(left, out.size() - count);
+            std::copy_n(this->_a.begin() + 1 + this->_offset, m,
+                        out.begin() + static_cast<std::ptrdiff_t>(count));
+            this->_offset += static_cast<int>(m);
+            count += m;
+        }
+        this->_pos += count;
+        return count;
+    }
+
+    /// Move to the next prenecklace whose Lyndon prefix length divides n
+    auto DeBruijnStream::_advance() -> bool {
+        auto& a = this->_a;
+        const auto top = static_cast<std::uint8_t>(this->_k - 1);
+        do {
+            auto j = static_cast<std::size_t>(this->_n);
+            while (j > 0 && a[j] == top) {
+                --j;
+            }
+            if (j == 0) {
+                return false;
+            }
+            ++a[j];
+            for (auto i = j + 1; i < a.size(); ++i) {
+                a[i] = a[i - j];
+            }
+            this->_p = static_cast<int>(j);
+        } while (this->_n % this->_p != 0);
+        this->_offset = 0;
+        return true;
+    }
+
+    /**
+     * @brief The number of words of length n whose necklace is smaller than `word`
+     *
+     * A word x has a rotation smaller than w iff the cyclic word x contains
+     * some w[1..i-1] c with c < w[i]. With the matching automaton of these
+     * patterns (states: the longest suffix that is a prefix of w), x avoids
+     * them cyclically iff reading x from some state returns to the same
+     * state without a match, and that state is unique. So the words with all
+     * rotations >= w are counted by the trace of M^n, M being the transition
+     * matrix of the automaton without the match state.
+     */
+    auto DeBruijnStream::_rank(const std::vector<std::uint8_t>& word) const -> std::uint64_t {
+        const auto n = static_cast<std::size_t>(this->_n);
+        const auto k = static_cast<std::size_t>(this->_k);
+        // failure function of w[1..n]
+        auto fail = std::vector<std::size_t>(n + 1, 0);
+        for (std::size_t q = 2; q <= n; ++q) {
+            auto b = fail[q - 1];
+            while (b > 0 && word[b + 1] != word[q]) {
+                b = fail[b];
+            }
+            fail[q] = word[b + 1] == word[q] ? b + 1 : 0;
+        }
+        // transitions; n + 1 stands for a completed pattern
+        const auto dead = n + 1;
+        auto next = std::vector<std::size_t>((n + 1) * k);
+        for (std::size_t q = 0; q <= n; ++q) {
+            for (std::size_t c = 0; c != k; ++c) {
+                const auto extends = q < n && c == word[q + 1];
+                auto target = std::size_t{0};
+                if ((q < n && c < word[q + 1]) || (q > 0 && next[fail[q] * k + c] == dead)) {
+                    target = dead;
+                } else if (extends) {
+                    target = q + 1;
+                } else if (q > 0) {
+                    target = next[fail[q] * k + c];
+                }
+                next[q * k + c] = target;
+            }
+        }
+        // rows of M as (target, multiplicity)
+        auto rows = std::vector<std::vector<std::pair<std::size_t, std::uint64_t>>>(n + 1);
+        for (std::size_t q = 0; q <= n; ++q) {
+            auto counts = std::vector<std::uint64_t>(n + 1, 0);
+            for (std::size_t c = 0; c != k; ++c) {
+                if (next[q * k + c] != dead) {
+                    ++counts[next[q * k + c]];
+                }
+            }
+            for (std::size_t t = 0; t <= n; ++t) {
+                if (counts[t] != 0) {
+                    rows[q].emplace_back(t, counts[t]);
+                }
+            }
+        }
+        // trace of M^n, one start state at a time
+        auto good = std::uint64_t{0};
+        auto walks = std::vector<std::uint64_t>(n + 1);
+        auto step = std::vector<std::uint64_t>(n + 1);
+        for (std::size_t start = 0; start <= n; ++start) {
+            std::fill(walks.begin(), walks.end(), 0);
+            walks[start] = 1;
+            for (std::size_t len = 0; len != n; ++len) {
+                std::fill(step.begin(), step.end(), 0);
+                for (std::size_t q = 0; q <= n; ++q) {
+                    if (walks[q] != 0) {
+                        for (const auto& [t, count] : rows[q]) {
+                            step[t] += walks[q] * count;
+                        }
+                    }
+                }
+                walks.swap(step);
+            }
+            good += walks[start];
+        }
+        return this->_length - good;
+    }
+
+    auto DeBruijnStream::seek(std::uint64_t pos) -> bool {
+        if (pos > this->_length) {
+            return false;
+        }
+        if (this->_length == 0) {
+            return true;
+        }
+        auto& a = this->_a;
+        if (pos == this->_length) {  // past the last Lyndon word k-1
+            std::fill(a.begin() + 1, a.end(), static_cast<std::uint8_t>(this->_k - 1));
+            this->_p = 1;
+            this->_offset = 1;
+            this->_pos = pos;
+            return true;
+        }
+        // the largest word w with rank(w) <= pos is the necklace covering pos
+        std::fill(a.begin(), a.end(), 0);
+        for (std::size_t i = 1; i < a.size(); ++i) {
+            auto lo = 0;
+            auto hi = this->_k - 1;
+            while (lo < hi) {
+                const auto mid = (lo + hi + 1) / 2;
+                a[i] = static_cast<std::uint8_t>(mid);
+                if (this->_rank(a) <= pos) {
+                    lo = mid;
+                } else {
+                    hi = mid - 1;
+                }
+            }
+            a[i] = static_cast<std::uint8_t>(lo);
+        }
+        this->_p = 1;
+        for (std::size_t i = 2; i < a.size(); ++i) {
+            if (a[i] != a[i - static_cast<std::size_t>(this->_p)]) {
+                this->_p = static_cast<int>(i);
+            }
+        }
+        this->_offset = static_cast<int>(pos - this->_rank(a));
+        this->_pos = pos;
+        return true;
+    }
+
+}  // namespace ecgen
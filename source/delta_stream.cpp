@@ -0,0 +1,300 @@
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <ecgen/delta_stream.hpp>
+#include <ecgen/mapped_file.hpp>
+#include <optional>
+#include <string>
+#include <utility>  // for exchange, move
+#include <vector>
+
+namespace ecgen {
+
+    namespace {
+        constexpr char magic[8] = {'E', 'C', 'G', 'D', 'E', 'L', 'T', 'A'};
+        constexpr std::uint32_t version = 1;
+        constexpr std::size_t header_size = 64;
+        constexpr std::size_t buffer_words = 8192;
+
+        /// Fixed-layout header; written field by field, so there is no padding
+        struct Header {
+            std::uint32_t version;
+            std::uint32_t move;
+            std::uint32_t object_size;
+            std::uint32_t bits;
+            std::uint32_t block_size;
+            std::uint64_t num_steps;
+            std::uint64_t num_blocks;
+            std::uint64_t index_offset;
+
+            auto encode() const -> std::vector<char> {
+                auto bytes = std::vector<char>(header_size, '\0');
+                auto* pos = bytes.data();
+                const auto put = [&pos](auto value) {
+                    value = little_endian(value);
+                    std::memcpy(pos, &value, sizeof value);
+                    pos += sizeof value;
+                };
+                std::memcpy(pos, magic, sizeof magic);
+                pos += sizeof magic;
+                put(this->version);
+                put(this->move);
+                put(this->object_size);
+                put(this->bits);
+                put(this->block_size);
+                put(std::uint32_t{0});  // reserved
+                put(this->num_steps);
+                put(this->num_blocks);
+                put(this->index_offset);
+                return bytes;
+            }
+
+            static auto decode(const std::byte* bytes) -> std::optional<Header> {
+                if (std::memcmp(bytes, magic, sizeof magic) != 0) {
+                    return std::nullopt;
+                }
+                auto header = Header{};
+                const auto* pos = bytes + sizeof magic;
+                const auto get = [&pos](auto& value) {
+                    std::memcpy(&value, pos, sizeof value);
+                    value = little_endian(value);
+                    pos += sizeof value;
+                };
+                get(header.version);
+                get(header.move);
+                get(header.object_size);
+                get(header.bits);
+                get(header.block_size);
+                pos += 4;  // reserved
+                get(header.num_steps);
+                get(header.num_blocks);
+                get(header.index_offset);
+                return header;
+            }
+        };
+
+        /// The number of blocks of a stream: every stream has at least the snapshot
+        auto blocks_for(std::uint64_t num_steps, std::uint32_t block_size) -> std::uint64_t {
+            return std::max<std::uint64_t>(1, (num_steps + block_size - 1) / block_size);
+        }
+    }  // namespace
+
+    auto DeltaStreamWriter::create(const std::string& path, DeltaMove move,
+                                   std::vector<int> initial, std::uint32_t block_size)
+        -> std::optional<DeltaStreamWriter> {
+        if (initial.empty() || block_size == 0 || move > DeltaMove::assign
+            || *std::min_element(initial.begin(), initial.end()) < 0) {
+            return std::nullopt;
+        }
+        const auto largest = std::max(static_cast<int>(initial.size()) - 1,
+                                      *std::max_element(initial.begin(), initial.end()));
+        const auto bits = static_cast<unsigned>(
+            std::bit_width(static_cast<std::uint32_t>(std::max(largest, 1))));
+        auto* file = std::fopen(path.c_str(), "wb");
+        if (file == nullptr) {
+            return std::nullopt;
+        }
+        const auto placeholder = std::vector<char>(header_size, '\0');
+        if (std::fwrite(placeholder.data(), 1, header_size, file) != header_size) {
+            std::fclose(file);
+            return std::nullopt;
+        }
+        return DeltaStreamWriter(file, move, std::move(initial), bits, block_size);
+    }
+
+    DeltaStreamWriter::DeltaStreamWriter(std::FILE* file, DeltaMove move,
+                                         std::vector<int> initial, unsigned bits,
+                                         std::uint32_t block_size)
+        : _file{file},
+          _move{move},
+          _object{std::move(initial)},
+          _bits{bits},
+          _block_size{block_size},
+          _offset{header_size} {
+        this->_buffer.reserve(buffer_words);
+        this->_start_block();
+    }
+
+    DeltaStreamWriter::DeltaStreamWriter(DeltaStreamWriter&& other) noexcept
+        : _file{std::exchange(other._file, nullptr)},
+          _move{other._move},
+          _object{std::move(other._object)},
+          _bits{other._bits},
+          _block_size{other._block_size},
+          _num_steps{other._num_steps},
+          _offset{other._offset},
+          _index{std::move(other._index)},
+          _buffer{std::move(other._buffer)},
+          _word{other._word},
+          _used{other._used},
+          _ok{other._ok} {}
+
+    DeltaStreamWriter::~DeltaStreamWriter() { this->close(); }
+
+    auto DeltaStreamWriter::push(int x, int y) -> bool {
+        const auto size = static_cast<int>(this->_object.size());
+        const auto limit = std::int64_t{1} << this->_bits;
+        if (x < 0 || x >= size) {
+            return false;
+        }
+        switch (this->_move) {
+            case DeltaMove::swap:
+                if (y < 0 || y >= size) {
+                    return false;
+                }
+                break;
+            case DeltaMove::swap_next:
+                if (x + 1 >= size) {
+                    return false;
+                }
+                break;
+            case DeltaMove::assign:
+                if (y < 0 || y >= limit) {
+                    return false;
+                }
+                break;
+            default:
+                break;
+        }
+        if (this->_num_steps != 0 && this->_num_steps % this->_block_size == 0) {
+            this->_start_block();
+        }
+        this->_put(static_cast<std::uint32_t>(x));
+        if (delta_move_arity(this->_move) == 2) {
+            this->_put(static_cast<std::uint32_t>(y));
+        }
+        apply_delta_move(this->_move, this->_object, x, y);
+        ++this->_num_steps;
+        return true;
+    }
+
+    auto DeltaStreamWriter::close() -> bool {
+        if (this->_file == nullptr) {
+            return this->_ok;
+        }
+        this->_flush_word();
+        this->_flush_buffer();
+        const auto header = Header{version,
+                                   static_cast<std::uint32_t>(this->_move),
+                                   static_cast<std::uint32_t>(this->_object.size()),
+                                   this->_bits,
+                                   this->_block_size,
+                                   this->_num_steps,
+                                   blocks_for(this->_num_steps, this->_block_size),
+                                   this->_offset}
+                                .encode();
+        for (auto& offset : this->_index) {
+            offset = little_endian(offset);
+        }
+        const auto index_bytes = this->_index.size() * sizeof(std::uint64_t);
+        this->_ok = this->_ok
+                    && std::fwrite(this->_index.data(), 1, index_bytes, this->_file) == index_bytes
+                    && std::fseek(this->_file, 0, SEEK_SET) == 0
+                    && std::fwrite(header.data(), 1, header.size(), this->_file) == header.size();
+        this->_ok = std::fclose(this->_file) == 0 && this->_ok;
+        this->_file = nullptr;
+        return this->_ok;
+    }
+
+    void DeltaStreamWriter::_put(std::uint32_t value) {
+        this->_word |= std::uint64_t{value} << this->_used;
+        this->_used += this->_bits;
+        if (this->_used >= 64) {  // keep the high bits of value that did not fit
+            this->_buffer.push_back(little_endian(this->_word));
+            this->_offset += 8;
+            this->_used -= 64;
+            this->_word = std::uint64_t{value} >> (this->_bits - this->_used);
+            if (this->_buffer.size() == buffer_words) {
+                this->_flush_buffer();
+            }
+        }
+    }
+
+    void DeltaStreamWriter::_start_block() {
+        this->_flush_word();
+        this->_index.push_back(this->_offset);
+        for (const auto entry : this->_object) {
+            this->_put(static_cast<std::uint32_t>(entry));
+        }
+    }
+
+    void DeltaStreamWriter::_flush_word() {
+        if (this->_used != 0) {
+            this->_buffer.push_back(little_endian(this->_word));
+            this->_offset += 8;
+            this->_word = 0;
+            this->_used = 0;
+        }
+    }
+
+    void DeltaStreamWriter::_flush_buffer() {
+        const auto bytes = this->_buffer.size() * sizeof(std::uint64_t);
+        this->_ok = this->_ok && std::fwrite(this->_buffer.data(), 1, bytes, this->_file) == bytes;
+        this->_buffer.clear();
+    }
+
+    auto DeltaStreamReader::open(const std::string& path) -> std::optional<DeltaStreamReader> {
+        auto file = MappedFile::open(path);
+        if (!file || file->size() < header_size) {
+            return std::nullopt;
+        }
+        const auto header = Header::decode(file->data());
+        if (!header || header->version != version
+            || header->move > static_cast<std::uint32_t>(DeltaMove::assign)
+            || header->object_size == 0 || header->bits == 0 || header->bits > 32
+            || header->block_size == 0
+            || header->num_blocks != blocks_for(header->num_steps, header->block_size)
+            || header->index_offset % 8 != 0 || header->index_offset > file->size()
+            || (file->size() - header->index_offset) / 8 < header->num_blocks) {
+            return std::nullopt;
+        }
+        auto reader = DeltaStreamReader(std::move(*file));
+        reader._move = static_cast<DeltaMove>(header->move);
+        reader._object_size = header->object_size;
+        reader._bits = header->bits;
+        reader._block_size = header->block_size;
+        reader._num_steps = header->num_steps;
+        reader._num_blocks = header->num_blocks;
+        reader._index_offset = header->index_offset;
+        // every block must fit in front of the index
+        const auto fields_per_step = std::uint64_t{delta_move_arity(reader._move)};
+        for (auto block = std::uint64_t{0}; block != reader._num_blocks; ++block) {
+            const auto bits = (reader._object_size + fields_per_step * reader.block_steps(block))
+                              * reader._bits;
+            const auto first = reader._block_bit(block);
+            if (first < header_size * 8 || first + bits > reader._index_offset * 8) {
+                return std::nullopt;
+            }
+        }
+        return reader;
+    }
+
+    auto DeltaStreamReader::snapshot(std::uint64_t block) const -> std::vector<int> {
+        auto object = std::vector<int>(this->_object_size);
+        auto bit = this->_block_bit(block);
+        for (auto& entry : object) {
+            entry = static_cast<int>(this->_read(bit));
+            bit += this->_bits;
+        }
+        return object;
+    }
+
+    auto DeltaStreamReader::object_at(std::uint64_t rank) const -> std::vector<int> {
+        if (rank > this->_num_steps) {
+            return {};
+        }
+        const auto block = std::min(rank / this->_block_size, this->_num_blocks - 1);
+        auto remaining = rank - block * this->_block_size;
+        auto object = this->snapshot(block);
+        this->for_each_move(block, [&](int x, int y) {
+            if (remaining != 0) {
+                --remaining;
+                apply_delta_move(this->_move, object, x, y);
+            }
+        });
+        return object;
+    }
+
+}  // namespace ecgen
@@ -0,0 +1,385 @@
+#include <algorithm>  // for max, min, sort, fill, copy_n
+#include <bit>  // for popcount
+#include <cstdint>
+#include <ecgen/diff_cover.hpp>
+#include <ecgen/work_stealing_pool.hpp>
+#include <mutex>
+#include <numeric>  // for gcd
+#include <optional>
+#include <utility>  // for move
+#include <vector>
+
+namespace ecgen {
+
+    namespace {
+        /**
+         * @brief The necklace form of a set of residues
+         *
+         * Returns the largest (lexicographically) sorted position vector
+         * a[1..d] with a[d] = n over all rotations of the set, which is the
+         * form in which the search reaches it.
+         */
+        auto necklace_form(int n, const std::vector<int>& set) -> std::vector<int> {
+            auto best = std::vector<int>{};
+            auto rotated = std::vector<int>(set.size());
+            for (const auto s : set) {
+                for (std::size_t i = 0; i != set.size(); ++i) {
+                    const auto r = ((set[i] - s) % n + n) % n;
+                    rotated[i] = r == 0 ? n : r;
+                }
+                std::sort(rotated.begin(), rotated.end());
+                if (best.empty() || best < rotated) {
+                    best = rotated;
+                }
+            }
+            return best;
+        }
+
+        void accumulate(DiffCoverStats& total, const DiffCoverStats& part) {
+            for (std::size_t t = 0; t != part.nodes.size(); ++t) {
+                total.nodes[t] += part.nodes[t];
+                total.pruned[t] += part.pruned[t];
+            }
+            total.covers += part.covers;
+            total.non_canonical += part.non_canonical;
+        }
+    }  // namespace
+
+    /**
+     * @brief A subtree of the search: the prefix a[0..t] and its period p
+     */
+    struct DiffCoverSearch::Task {
+        int t;
+        int p;
+        std::vector<int> a;
+    };
+
+    /**
+     * @brief Depth-first search state of one thread
+     *
+     * `_diffs` holds one packed bitset of n/2 + 1 bits per depth; row t marks
+     * the differences (folded into 1..n/2) covered by a[0..t]. Copying a row
+     * and counting its bits cost (n/2 + 64) / 64 word operations each.
+     */
+    class DiffCoverSearch::Worker {
+      public:
+        explicit Worker(DiffCoverSearch& search)
+            : _search{search},
+              _n{search._n},
+              _d{search._d},
+              _n1{search._n / 2 - search._d * (search._d - 1) / 2},
+              _n2{search._n / 2},
+              _words{(search._n / 2 + 64) / 64},
+              _a(static_cast<std::size_t>(search._d) + 1, 0),
+              _diffs(static_cast<std::size_t>(search._d * _words), 0) {
+            this->_a[static_cast<std::size_t>(this->_d)] = this->_n;
+            this->_stats.nodes.assign(static_cast<std::size_t>(this->_d), 0);
+            this->_stats.pruned.assign(static_cast<std::size_t>(this->_d), 0);
+        }
+
+        auto stats() const noexcept -> const DiffCoverStats& { return this->_stats; }
+
+        /**
+         * @brief Collect the subtrees rooted at a[1]
+         *
+         * @param[out] tasks - The subtrees.
+         */
+        void roots(std::vector<Task>& tasks) {
+            this->_split_depth = 1;
+            this->_tasks = &tasks;
+            this->_root();
+            this->_tasks = nullptr;
+        }
+
+        /**
+         * @brief Search the subtree of a task
+         *
+         * @param[in] task - The subtree.
+         * @param[out] children - If given, the search stops one level down
+         * and collects the subtrees there instead.
+         */
+        void run(const Task& task, std::vector<Task>* children = nullptr) {
+            this->_split_depth = children != nullptr ? task.t + 1 : -1;
+            this->_tasks = children;
+            std::copy(task.a.begin(), task.a.end(), this->_a.begin());
+            auto* prev = this->_row(task.t - 1);
+            std::fill(prev, prev + this->_words, std::uint64_t{0});
+            for (int i = 1; i < task.t; ++i) {
+                this->_mark(prev, i);
+            }
+            this->_gen(task.t, task.p);
+            this->_tasks = nullptr;
+        }
+
+      private:
+        auto _row(int t) -> std::uint64_t* {
+            return this->_diffs.data() + static_cast<std::size_t>(t * this->_words);
+        }
+
+        /**
+         * @brief Mark the differences between a[t] and a[0..t-1]
+         */
+        void _mark(std::uint64_t* row, int t) const {
+            const auto at = this->_a[static_cast<std::size_t>(t)];
+            for (int i = 0; i != t; ++i) {
+                const auto diff = at - this->_a[static_cast<std::size_t>(i)];
+                const auto n_diff = this->_n - diff;
+                const auto bit = static_cast<unsigned>(diff <= n_diff ? diff : n_diff);
+                row[bit / 64] |= std::uint64_t{1} << (bit % 64);
+            }
+        }
+
+        void _root() {
+            auto* row = this->_row(0);
+            std::fill(row, row + this->_words, std::uint64_t{0});
+            // a[1] is the widest gap of the necklace; the other elements lie
+            // in an arc of length n - a[1], which must span a difference n/2
+            const auto start = std::min(this->_n - this->_d + 1, this->_n - this->_n2);
+            const auto end = (this->_n - 1) / this->_d + 1;
+            for (auto j = start; j >= end; --j) {
+                this->_a[1] = j;
+                this->_gen(1, 1);
+            }
+        }
+
+        /**
+         * @brief Fixed-density necklace recursion (GenD) with coverage pruning
+         *
+         * @param[in] t - The index of the element just placed.
+         * @param[in] p - The length of the longest Lyndon prefix.
+         */
+        void _gen(int t, int p) {
+            if (this->_search._stop.load(std::memory_order_relaxed)) {
+                return;
+            }
+            if (t == this->_split_depth) {
+                this->_tasks->push_back(Task{t, p, {this->_a.begin(), this->_a.begin() + t + 1}});
+                return;
+            }
+
+            ++this->_stats.nodes[static_cast<std::size_t>(t)];
+            auto* row = this->_row(t);
+            std::copy_n(this->_row(t - 1), this->_words, row);
+            this->_mark(row, t);
+
+            const auto count = this->_count_from(row, 1);
+            if (!this->_within_bounds(t, row, count)) {
+                ++this->_stats.pruned[static_cast<std::size_t>(t)];
+                return;
+            }
+
+            const auto t1 = t + 1;
+            if (t1 >= this->_d) {
+                if (count == this->_n2 && this->_is_necklace(p)) {
+                    ++this->_stats.covers;
+                    if (this->_is_canonical()) {
+                        this->_report();
+                    } else {
+                        ++this->_stats.non_canonical;
+                    }
+                }
+                return;
+            }
+            auto tail = this->_n - this->_d + t1;
+            const auto max = this->_a[static_cast<std::size_t>(t1 - p)]
+                             + this->_a[static_cast<std::size_t>(p)];
+            if (max <= tail) {
+                this->_a[static_cast<std::size_t>(t1)] = max;
+                this->_gen(t1, p);
+                tail = max - 1;
+            }
+            for (auto j = tail; j >= this->_a[static_cast<std::size_t>(t)] + 1; --j) {
+                this->_a[static_cast<std::size_t>(t1)] = j;
+                this->_gen(t1, t1);
+            }
+        }
+
+        /**
+         * @brief Number of set bits with index >= lo
+         */
+        auto _count_from(const std::uint64_t* row, int lo) const -> int {
+            auto i = lo / 64;
+            auto count = std::popcount(row[i] >> (lo % 64));
+            while (++i < this->_words) {
+                count += std::popcount(row[i]);
+            }
+            return count;
+        }
+
+        auto _within_bounds(int t, const std::uint64_t* row, int count) const -> bool {
+            if (t < this->_search._threshold) {
+                return true;
+            }
+            // the elements still to be placed add at most t+1, ..., d-1 differences
+            if (count < this->_n1 + t * (t + 1) / 2) {
+                return false;
+            }
+            // they lie in [a[t]+1, n-1], so differences above n-2-a[t] between
+            // them are impossible: each adds at most t+1 of those
+            const auto width = this->_n - 2 - this->_a[static_cast<std::size_t>(t)];
+            if (t < this->_d - 1 && width < this->_n2) {
+                const auto missing = this->_n2 - width - this->_count_from(row, width + 1);
+                if (missing > (this->_d - 1 - t) * (t + 1)) {
+                    return false;
+                }
+            }
+            return !this->_search._bound || this->_search._bound(t, this->_a, count);
+        }
+
+        /**
+         * @brief Whether the current cover is the representative of its orbit
+         */
+        auto _is_canonical() const -> bool {
+            if (this->_search._symmetry == DiffCoverSymmetry::rotation) {
+                return true;
+            }
+            const auto own = std::vector<int>(this->_a.begin() + 1, this->_a.end());
+            auto image = std::vector<int>(own.size());
+            for (auto u = 2; u != this->_n; ++u) {
+                if (this->_search._symmetry == DiffCoverSymmetry::dihedral && u != this->_n - 1) {
+                    continue;
+                }
+                if (std::gcd(u, this->_n) != 1) {
+                    continue;
+                }
+                for (std::size_t i = 0; i != own.size(); ++i) {
+                    image[i] = static_cast<int>(static_cast<long long>(own[i]) * u % this->_n);
+                }
+                if (own < necklace_form(this->_n, image)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /**
+         * @brief Necklace test of a complete prenecklace (PrintD in necklace.c)
+         */
+        auto _is_necklace(int p) const -> bool {
+            const auto next = (this->_d / p) * this->_a[static_cast<std::size_t>(p)]
+                              + this->_a[static_cast<std::size_t>(this->_d % p)];
+            return next > this->_n || (next == this->_n && this->_d % p == 0);
+        }
+
+        void _report() {
+            auto cover = std::vector<int>(this->_a.begin() + 1, this->_a.end());
+            auto lock = std::lock_guard<std::mutex>{this->_search._mutex};
+            if (this->_search._mode == Mode::first) {
+                if (this->_search._found.empty()) {
+                    this->_search._found.push_back(std::move(cover));
+                }
+                this->_search._stop.store(true, std::memory_order_relaxed);
+            } else {
+                this->_search._found.push_back(std::move(cover));
+            }
+        }
+
+        DiffCoverSearch& _search;
+        int _n;
+        int _d;
+        int _n1;
+        int _n2;
+        int _words;
+        std::vector<int> _a;
+        std::vector<std::uint64_t> _diffs;
+        int _split_depth{-1};
+        std::vector<Task>* _tasks{nullptr};
+        DiffCoverStats _stats;
+    };
+
+    DiffCoverSearch::DiffCoverSearch(int n, int d, int threshold)
+        : _n{n}, _d{d}, _threshold{threshold} {}
+
+    void DiffCoverSearch::set_min_coverage(std::vector<int> min_covered) {
+        this->_bound = [table = std::move(min_covered), next = std::move(this->_bound)](
+                           int t, const std::vector<int>& a, int covered) {
+            if (static_cast<std::size_t>(t) < table.size()
+                && covered < table[static_cast<std::size_t>(t)]) {
+                return false;
+            }
+            return !next || next(t, a, covered);
+        };
+    }
+
+    auto DiffCoverSearch::find_first(unsigned num_workers) -> std::optional<std::vector<int>> {
+        auto pool = WorkStealingPool(num_workers);
+        return this->find_first(pool);
+    }
+
+    auto DiffCoverSearch::find_first(WorkStealingPool& pool) -> std::optional<std::vector<int>> {
+        auto found = this->_run(Mode::first, pool);
+        if (found.empty()) {
+            return std::nullopt;
+        }
+        return std::move(found.front());
+    }
+
+    auto DiffCoverSearch::find_all(unsigned num_workers) -> std::vector<std::vector<int>> {
+        auto pool = WorkStealingPool(num_workers);
+        return this->find_all(pool);
+    }
+
+    auto DiffCoverSearch::find_all(WorkStealingPool& pool) -> std::vector<std::vector<int>> {
+        auto found = this->_run(Mode::all, pool);
+        std::sort(found.begin(), found.end());
+        return found;
+    }
+
+    auto DiffCoverSearch::_run(Mode mode, WorkStealingPool& pool) -> std::vector<std::vector<int>> {
+        auto found = this->_walk(mode, pool);
+        // cleared on the way out, so that a cancel() issued before the search
+        // started is not lost
+        this->_stop.store(false, std::memory_order_relaxed);
+        return found;
+    }
+
+    auto DiffCoverSearch::_walk(Mode mode, WorkStealingPool& pool)
+        -> std::vector<std::vector<int>> {
+        this->_mode = mode;
+        this->_found.clear();
+        this->_stats = DiffCoverStats{};
+        this->_stats.nodes.assign(static_cast<std::size_t>(std::max(this->_d, 0)), 0);
+        this->_stats.pruned = this->_stats.nodes;
+        // d elements give at most d(d-1) nonzero differences
+        if (this->_d < 2 || this->_n < this->_d || this->_n > this->_d * (this->_d - 1) + 1) {
+            return {};
+        }
+        auto tasks = std::vector<Task>{};
+        auto splitter = Worker(*this);
+        splitter.roots(tasks);
+        split_frontier(pool, tasks, 1, this->_d - 1,
+                       [&splitter](Task& task, int, std::vector<Task>& children) {
+                           splitter.run(task, &children);
+                       });
+        accumulate(this->_stats, splitter.stats());  // the nodes above the split depth
+
+        auto workers = std::vector<Worker>{};
+        workers.reserve(pool.num_workers());
+        for (auto i = 0U; i != pool.num_workers(); ++i) {
+            workers.emplace_back(*this);
+        }
+        pool.parallel_for(0, tasks.size(), [&](std::size_t i) {
+            if (!this->_stop.load(std::memory_order_relaxed)) {
+                workers[static_cast<std::size_t>(pool.worker_index())].run(tasks[i]);
+            }
+        });
+        for (const auto& worker : workers) {
+            accumulate(this->_stats, worker.stats());
+        }
+        return std::move(this->_found);
+    }
+
+    auto DiffCoverSearch::is_difference_cover(int n, const std::vector<int>& set) -> bool {
+        if (n <= 0) {
+            return false;
+        }
+        auto covered = std::vector<char>(static_cast<std::size_t>(n), 0);
+        for (const auto x : set) {
+            for (const auto y : set) {
+                covered[static_cast<std::size_t>(((x - y) % n + n) % n)] = 1;
+            }
+        }
+        return std::all_of(covered.begin() + 1, covered.end(), [](char c) { return c != 0; });
+    }
+
+}  // namespace ecgen
@@ -1,4 +1,7 @@
+#include <cstddef>
 #include <ecgen/gray_code.hpp>
+#include <utility>
+#include <vector>
 
 namespace ecgen {
 
@@ -22,4 +25,51 @@ namespace ecgen {
         co_yield brgc_gen(n - 1);
     }
 
+    /**
+     * @brief Reflected mixed-radix Gray code (Knuth's Algorithm H)
+     *
+     * Only coordinates with radix >= 2 take part in the algorithm; `coords`
+     * maps them back to their position in `radices`. The focus pointers `focus`
+     * make every step loopless, and `dirs` holds the current direction of each
+     * coordinate.
+     *
+     * @param[in] radices The base of each coordinate.
+     * @return py::Generator<std::pair<int, int>>
+     */
+    auto mixed_radix_gray_gen(std::vector<int> radices) -> py::Generator<std::pair<int, int>> {
+        auto coords = std::vector<int>{};
+        auto bases = std::vector<int>{};
+        for (std::size_t j = 0; j != radices.size(); ++j) {
+            if (radices[j] < 1) {
+                co_return;  // no tuples at all
+            }
+            if (radices[j] >= 2) {
+                coords.push_back(static_cast<int>(j));
+                bases.push_back(radices[j]);
+            }
+        }
+        const auto n = bases.size();
+        auto digits = std::vector<int>(n, 0);
+        auto dirs = std::vector<int>(n, 1);
+        auto focus = std::vector<std::size_t>(n + 1);
+        for (std::size_t j = 0; j <= n; ++j) {
+            focus[j] = j;
+        }
+
+        while (true) {
+            const auto j = focus[0];
+            focus[0] = 0;
+            if (j == n) {
+                break;
+            }
+            digits[j] += dirs[j];
+            co_yield std::make_pair(coords[j], dirs[j]);
+            if (digits[j] == 0 || digits[j] == bases[j] - 1) {
+                dirs[j] = -dirs[j];
+                focus[j] = focus[j + 1];
+                focus[j + 1] = j + 1;
+            }
+        }
+    }
+
 }  // namespace ecgen
@@ -0,0 +1,148 @@
+#include <bit>  // for countr_zero, popcount, bit_width
+#include <cstddef>
+#include <cstdint>
+#include <ecgen/integer_partition.hpp>
+#include <vector>
+
+namespace ecgen {
+
+    Compositions::Compositions(int n) {
+        if (n < 0 || n > 64) {
+            this->_empty = true;
+            return;
+        }
+        this->_parts.reserve(static_cast<std::size_t>(n));
+        if (n > 0) {
+            this->_parts.push_back(n);
+            this->_steps = (std::uint64_t{1} << (n - 1)) - 1;
+        }
+    }
+
+    auto Compositions::next() -> bool {
+        if (this->_step == this->_steps) {
+            return false;
+        }
+        ++this->_step;
+        const auto j = std::countr_zero(this->_step);
+        const auto below = this->_cuts & ((std::uint64_t{1} << j) - 1);
+        const auto i = std::popcount(below);  // the part holding unit j+1
+        auto part = this->_parts.begin() + i;
+        this->_cuts ^= std::uint64_t{1} << j;
+        this->_index = i;
+        this->_split = (this->_cuts >> j) & 1U;
+        if (this->_split) {
+            // the units since the previous cut go to the left half
+            const auto left = j + 1 - static_cast<int>(std::bit_width(below));
+            *part -= left;
+            this->_parts.insert(part, left);  // within the reserved capacity
+        } else {
+            *part += *(part + 1);
+            this->_parts.erase(part + 1);
+        }
+        return true;
+    }
+
+    /**
+     * The walk relies on two tables, for j parts summing to t (above the
+     * minimum): the part that loses a unit from the first composition of
+     * (j, t) to the first of (j, t-1), and the same for the last ones. The
+     * first composition is filled greedily from the front, so it drops a unit
+     * in its last nonzero part. The last one ends in the sublist for
+     * x = min(m, t), reversed when x is odd.
+     */
+    BoundedCompositions::BoundedCompositions(int n, int k, int max_part, int min_part)
+        : _n{n - k * min_part}, _k{k}, _m{max_part - min_part}, _min{min_part} {
+        if (k < 1 || min_part < 0 || this->_m < 0 || this->_n < 0 || this->_n > k * this->_m) {
+            this->_k = 0;
+            return;
+        }
+        this->_parts.resize(static_cast<std::size_t>(k));
+        const auto width = static_cast<std::size_t>(this->_n) + 1;
+        this->_first.assign(static_cast<std::size_t>(k + 1) * width, 0);
+        this->_last.assign(static_cast<std::size_t>(k + 1) * width, 0);
+        const auto m = this->_m;
+        for (auto j = 2; j <= k; ++j) {
+            const auto row = static_cast<std::size_t>(j) * width;
+            const auto prev = static_cast<std::size_t>(j - 1) * width;
+            for (auto t = 1; t <= this->_n && t <= j * m; ++t) {
+                const auto at = static_cast<std::size_t>(t);
+                this->_first[row + at] = t > (j - 1) * m ? j - 1 : this->_first[prev + at];
+                if (t <= m) {
+                    this->_last[row + at] = j - 1;
+                } else {
+                    const auto& down = m % 2 == 0 ? this->_last : this->_first;
+                    this->_last[row + at] = down[prev + static_cast<std::size_t>(t - m)];
+                }
+            }
+        }
+    }
+
+    IntegerPartitions::IntegerPartitions(int n, int max_part) {
+        if (n < 0 || (n > 0 && max_part < 1)) {
+            this->_empty = true;
+            return;
+        }
+        const auto k = max_part < n ? max_part : n;
+        const auto size = static_cast<std::size_t>(k) + 1;
+        this->_value.resize(size);
+        this->_count.resize(size);
+        this->_mult.assign(size, 0);
+        if (n > 0) {
+            this->_push(k, n / k);
+            this->_change(k, n / k);
+            if (n % k != 0) {
+                this->_push(n % k, 1);
+                this->_change(n % k, 1);
+            }
+        }
+    }
+
+    auto IntegerPartitions::next() -> bool {
+        if (this->_top == 0 || this->_value[0] == 1) {
+            return false;
+        }
+        this->_num_changes = 0;
+        auto ones = 0;
+        if (this->_value[this->_top - 1] == 1) {
+            ones = this->_count[--this->_top];
+            this->_change(1, -ones);
+        }
+        const auto x = this->_value[this->_top - 1];
+        if (--this->_count[this->_top - 1] == 0) {
+            --this->_top;
+        }
+        this->_change(x, -1);
+        const auto sum = x + ones;
+        const auto y = x - 1;
+        this->_push(y, sum / y);
+        this->_change(y, sum / y);
+        if (sum % y != 0) {
+            this->_push(sum % y, 1);
+            this->_change(sum % y, 1);
+        }
+        return true;
+    }
+
+    void IntegerPartitions::_push(int value, int count) {
+        this->_value[this->_top] = value;
+        this->_count[this->_top] = count;
+        ++this->_top;
+    }
+
+    /// Record a change, merging it with an earlier one of the same part
+    void IntegerPartitions::_change(int part, int count) {
+        this->_mult[static_cast<std::size_t>(part)] += count;
+        for (std::size_t i = 0; i != this->_num_changes; ++i) {
+            auto& change = this->_changes[i];
+            if (change.part == part) {
+                change.count += count;
+                if (change.count == 0) {
+                    change = this->_changes[--this->_num_changes];
+                }
+                return;
+            }
+        }
+        this->_changes[this->_num_changes++] = PartChange{part, count};
+    }
+
+}  // namespace ecgen
@@ -0,0 +1,91 @@
+#include <cstddef>
+#include <ecgen/mapped_file.hpp>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <utility>  // for exchange, move
+
+#if defined(__unix__) || defined(__APPLE__)
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#    define ECGEN_HAS_MMAP 1
+#else
+#    define ECGEN_HAS_MMAP 0
+#endif
+
+namespace ecgen {
+
+    auto MappedFile::open(const std::string& path) -> std::optional<MappedFile> {
+        auto file = MappedFile{};
+#if ECGEN_HAS_MMAP
+        const auto fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return std::nullopt;
+        }
+        struct stat info {};
+        if (::fstat(fd, &info) != 0) {
+            ::close(fd);
+            return std::nullopt;
+        }
+        file._size = static_cast<std::size_t>(info.st_size);
+        if (file._size != 0) {
+            auto* addr = ::mmap(nullptr, file._size, PROT_READ, MAP_SHARED, fd, 0);
+            if (addr == MAP_FAILED) {
+                ::close(fd);
+                return std::nullopt;
+            }
+            file._data = static_cast<const std::byte*>(addr);
+            file._mapped = true;
+        }
+        ::close(fd);  // the mapping keeps its own reference
+#else
+        auto stream = std::ifstream(path, std::ios::binary | std::ios::ate);
+        if (!stream) {
+            return std::nullopt;
+        }
+        file._copy.resize(static_cast<std::size_t>(stream.tellg()));
+        stream.seekg(0);
+        if (!stream.read(reinterpret_cast<char*>(file._copy.data()),
+                         static_cast<std::streamsize>(file._copy.size()))) {
+            return std::nullopt;
+        }
+        file._data = file._copy.data();
+        file._size = file._copy.size();
+#endif
+        return file;
+    }
+
+    MappedFile::MappedFile(MappedFile&& other) noexcept
+        : _data{std::exchange(other._data, nullptr)},
+          _size{std::exchange(other._size, 0)},
+          _mapped{std::exchange(other._mapped, false)},
+          _copy{std::move(other._copy)} {}
+
+    auto MappedFile::operator=(MappedFile&& other) noexcept -> MappedFile& {
+        if (this != &other) {
+            this->_release();
+            this->_data = std::exchange(other._data, nullptr);
+            this->_size = std::exchange(other._size, 0);
+            this->_mapped = std::exchange(other._mapped, false);
+            this->_copy = std::move(other._copy);
+        }
+        return *this;
+    }
+
+    MappedFile::~MappedFile() { this->_release(); }
+
+    void MappedFile::_release() noexcept {
+#if ECGEN_HAS_MMAP
+        if (this->_mapped) {
+            ::munmap(const_cast<std::byte*>(this->_data), this->_size);
+        }
+#endif
+        this->_data = nullptr;
+        this->_size = 0;
+        this->_mapped = false;
+        this->_copy.clear();
+    }
+
+}  // namespace ecgen
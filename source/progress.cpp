@@ -0,0 +1,110 @@
+#include <spdlog/spdlog.h>
+
+#include <chrono>
+#include <cstdint>
+#include <ecgen/progress.hpp>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>  // for move
+
+namespace ecgen {
+
+    namespace {
+        /// seconds as h:mm:ss, or "?" if unknown
+        auto hms(double seconds) -> std::string {
+            if (seconds < 0.0) {
+                return "?";
+            }
+            const auto total = static_cast<std::uint64_t>(seconds + 0.5);
+            return fmt::format("{}:{:02}:{:02}", total / 3600, total / 60 % 60, total % 60);
+        }
+    }  // namespace
+
+    auto ProgressSnapshot::next(std::uint64_t done, double elapsed,
+                                const ProgressSnapshot& previous, std::uint64_t expected)
+        -> ProgressSnapshot {
+        auto snapshot = ProgressSnapshot{done, elapsed, 0.0, -1.0, -1.0};
+        const auto interval = elapsed - previous.elapsed;
+        if (interval > 0.0 && done >= previous.done) {
+            snapshot.rate = static_cast<double>(done - previous.done) / interval;
+        }
+        if (expected != 0) {
+            snapshot.fraction = static_cast<double>(done) / static_cast<double>(expected);
+            if (done >= expected) {
+                snapshot.eta = 0.0;
+            } else if (done != 0 && elapsed > 0.0) {
+                const auto average = static_cast<double>(done) / elapsed;
+                snapshot.eta = static_cast<double>(expected - done) / average;
+            }
+        }
+        return snapshot;
+    }
+
+    ProgressReporter::ProgressReporter(const ProgressCounter& counter, std::string name,
+                                       std::uint64_t expected, std::chrono::milliseconds interval)
+        : _counter{counter},
+          _name{std::move(name)},
+          _expected{expected},
+          _interval{interval},
+          _start{std::chrono::steady_clock::now()},
+          _thread{[this]() { this->_loop(); }} {}
+
+    ProgressReporter::~ProgressReporter() { this->stop(); }
+
+    void ProgressReporter::stop() {
+        {
+            auto lock = std::lock_guard<std::mutex>{this->_mutex};
+            if (this->_stop) {
+                return;
+            }
+            this->_stop = true;
+        }
+        this->_cv.notify_all();
+        this->_thread.join();
+        this->_report(true);
+    }
+
+    auto ProgressReporter::last() const -> ProgressSnapshot {
+        auto lock = std::lock_guard<std::mutex>{this->_mutex};
+        return this->_last;
+    }
+
+    void ProgressReporter::_loop() {
+        auto lock = std::unique_lock<std::mutex>{this->_mutex};
+        while (!this->_cv.wait_for(lock, this->_interval, [this]() { return this->_stop; })) {
+            lock.unlock();
+            this->_report(false);
+            lock.lock();
+        }
+    }
+
+    void ProgressReporter::_report(bool final) {
+        const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now()
+                                                           - this->_start)
+                                 .count();
+        auto snapshot = ProgressSnapshot{};
+        {
+            auto lock = std::lock_guard<std::mutex>{this->_mutex};
+            snapshot = ProgressSnapshot::next(this->_counter.total(), elapsed, this->_last,
+                                              this->_expected);
+            this->_last = snapshot;
+        }
+
+        if (final) {
+            spdlog::info("{}: done, {} items in {} ({:.3g}/s)", this->_name, snapshot.done,
+                         hms(snapshot.elapsed),
+                         snapshot.elapsed > 0.0
+                             ? static_cast<double>(snapshot.done) / snapshot.elapsed
+                             : 0.0);
+        } else if (snapshot.fraction >= 0.0) {
+            spdlog::info("{}: {}/{} ({:.1f}%), {:.3g}/s, ETA {}", this->_name, snapshot.done,
+                         this->_expected, 100.0 * snapshot.fraction, snapshot.rate,
+                         hms(snapshot.eta));
+        } else {
+            spdlog::info("{}: {}, {:.3g}/s, elapsed {}", this->_name, snapshot.done,
+                         snapshot.rate, hms(snapshot.elapsed));
+        }
+    }
+
+}  // namespace ecgen
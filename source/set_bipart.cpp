@@ -71,4 +71,80 @@ namespace ecgen {
         co_yield gen1_even(n - 1);
         co_yield 2;
     }
+
+    /**
+     * @brief Construct a new Set Bipart Iterator object
+     *
+     * @param[in] n The parameter `n` represents the number of elements in the
+     * set.
+     */
+    SetBipartIterator::SetBipartIterator(int n) {
+        if (n >= 3 && n <= 64) {  // the mask and Frame::n hold at most 64 elements
+            this->_mask = std::uint64_t{1} << (n - 1);
+            this->_stack[this->_top++] = Frame{Kind::gen0, 0, static_cast<std::int8_t>(n)};
+        }
+    }
+
+    /**
+     * @brief Advance to the next bipartition
+     *
+     * Each frame mirrors one of gen0_even, gen1_even or neg1_even above, with
+     * `pc` recording how far its body has progressed. Recursive calls with
+     * n < 3 are empty and therefore never pushed, and the last call of a body
+     * reuses the current frame.
+     *
+     * @return true if an element was moved, false at the end of the sequence.
+     */
+    auto SetBipartIterator::next() -> bool {
+        while (this->_top != 0) {
+            auto& frame = this->_stack[this->_top - 1];
+            const int n = frame.n;
+            switch (frame.kind) {
+                case Kind::gen0:  // S(n, k, 0)
+                    switch (frame.pc++) {
+                        case 0:
+                            return this->_move(n - 1);
+                        case 1:
+                            this->_call(Kind::gen1, n - 1);
+                            break;
+                        case 2:
+                            return this->_move(n);
+                        default:
+                            this->_tail_call(Kind::neg1, n - 1);
+                            break;
+                    }
+                    break;
+                case Kind::gen1:  // S(n, k, 1)
+                    switch (frame.pc++) {
+                        case 0:
+                            return this->_move(2);
+                        case 1:
+                            this->_call(Kind::neg1, n - 1);
+                            break;
+                        case 2:
+                            return this->_move(n);
+                        default:
+                            this->_tail_call(Kind::gen1, n - 1);
+                            break;
+                    }
+                    break;
+                case Kind::neg1:  // S'(n, k, 1)
+                    switch (frame.pc++) {
+                        case 0:
+                            this->_call(Kind::neg1, n - 1);
+                            break;
+                        case 1:
+                            return this->_move(n);
+                        case 2:
+                            this->_call(Kind::gen1, n - 1);
+                            break;
+                        default:
+                            --this->_top;
+                            return this->_move(2);
+                    }
+                    break;
+            }
+        }
+        return false;
+    }
 }  // namespace ecgen
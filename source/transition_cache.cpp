@@ -0,0 +1,178 @@
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <ecgen/combin.hpp>
+#include <ecgen/set_partition.hpp>
+#include <ecgen/transition_cache.hpp>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <system_error>
+#include <utility>  // for move, pair
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#    include <unistd.h>  // for getpid
+#    define ECGEN_HAS_GETPID 1
+#else
+#    include <process.h>  // for _getpid
+#    define ECGEN_HAS_GETPID 0
+#endif
+
+namespace ecgen {
+
+    namespace {
+        constexpr char magic[8] = {'E', 'C', 'G', 'T', 'R', 'A', 'N', 'S'};
+        constexpr std::uint32_t version = 1;
+        constexpr std::size_t header_size = 32;
+        constexpr std::size_t chunk_size = std::size_t(1) << 16;
+
+        /// magic, version, kind, n, k, number of moves
+        auto encode_header(TransitionKind kind, int n, int k, std::uint64_t count)
+            -> std::vector<char> {
+            auto bytes = std::vector<char>(header_size, '\0');
+            const std::uint32_t fields[] = {version, static_cast<std::uint32_t>(kind),
+                                            static_cast<std::uint32_t>(n),
+                                            static_cast<std::uint32_t>(k)};
+            std::memcpy(bytes.data(), magic, sizeof magic);
+            std::memcpy(bytes.data() + 8, fields, sizeof fields);
+            std::memcpy(bytes.data() + 24, &count, sizeof count);
+            return bytes;
+        }
+
+        /// numbers the temporary files of this process
+        std::atomic<unsigned> temp_serial{0};
+
+        auto process_id() -> long {
+#if ECGEN_HAS_GETPID
+            return static_cast<long>(::getpid());
+#else
+            return static_cast<long>(::_getpid());
+#endif
+        }
+
+        auto valid_args(TransitionKind kind, int n, int k) -> bool {
+            return (kind == TransitionKind::emk_comb || kind == TransitionKind::set_partition)
+                   && n >= 1 && n < 256 && k >= 0 && k <= n;
+        }
+
+        /// Writes the moves in chunks and counts them
+        class MoveWriter {
+          public:
+            explicit MoveWriter(std::FILE* file) : _file{file} { this->_chunk.reserve(chunk_size); }
+
+            void put(int x, int y) {
+                this->_chunk.push_back(static_cast<char>(x));
+                this->_chunk.push_back(static_cast<char>(y));
+                ++this->_count;
+                if (this->_chunk.size() >= chunk_size) {
+                    this->flush();
+                }
+            }
+
+            void flush() {
+                this->_ok = this->_ok
+                            && std::fwrite(this->_chunk.data(), 1, this->_chunk.size(), this->_file)
+                                   == this->_chunk.size();
+                this->_chunk.clear();
+            }
+
+            auto count() const noexcept -> std::uint64_t { return this->_count; }
+            auto ok() const noexcept -> bool { return this->_ok; }
+
+          private:
+            std::FILE* _file;
+            std::vector<char> _chunk;
+            std::uint64_t _count{0};
+            bool _ok{true};
+        };
+    }  // namespace
+
+    auto TransitionTable::file_name(TransitionKind kind, int n, int k) -> std::string {
+        const auto* prefix = kind == TransitionKind::emk_comb ? "emk_comb_" : "set_partition_";
+        return prefix + std::to_string(n) + "_" + std::to_string(k) + ".ect";
+    }
+
+    auto TransitionTable::build(const std::string& path, TransitionKind kind, int n, int k)
+        -> bool {
+        if (!valid_args(kind, n, k)) {
+            return false;
+        }
+        // a name no other builder uses, renamed into place when complete; the
+        // exclusive open skips a leftover of a crashed process with our pid
+        auto temp = std::string{};
+        auto* file = static_cast<std::FILE*>(nullptr);
+        for (auto attempt = 0; attempt != 16 && file == nullptr; ++attempt) {
+            temp = path + ".tmp" + std::to_string(process_id()) + "_"
+                   + std::to_string(temp_serial.fetch_add(1, std::memory_order_relaxed));
+            file = std::fopen(temp.c_str(), "wbx");
+        }
+        if (file == nullptr) {
+            return false;
+        }
+        auto writer = MoveWriter(file);
+        auto ok = std::fseek(file, long(header_size), SEEK_SET) == 0;
+        if (kind == TransitionKind::emk_comb) {
+            for (const auto& [x, y] : emk_comb_gen(n, k)) {
+                writer.put(x, y);
+            }
+        } else {
+            for (const auto& [x, y] : set_partition_gen(n, k)) {
+                writer.put(x, y);
+            }
+        }
+        writer.flush();
+        const auto header = encode_header(kind, n, k, writer.count());
+        ok = ok && writer.ok() && std::fseek(file, 0, SEEK_SET) == 0
+             && std::fwrite(header.data(), 1, header.size(), file) == header.size();
+        ok = std::fclose(file) == 0 && ok;
+        auto error = std::error_code{};
+        if (ok) {
+            std::filesystem::rename(temp, path, error);
+        }
+        if (!ok || error) {
+            std::filesystem::remove(temp, error);
+            return false;
+        }
+        return true;
+    }
+
+    auto TransitionTable::load(const std::string& cache_dir, TransitionKind kind, int n, int k)
+        -> std::optional<TransitionTable> {
+        if (!valid_args(kind, n, k)) {
+            return std::nullopt;
+        }
+        const auto path = (std::filesystem::path(cache_dir) / file_name(kind, n, k)).string();
+        if (auto table = _open(path, kind, n, k)) {
+            return table;
+        }
+        if (!build(path, kind, n, k)) {
+            return std::nullopt;
+        }
+        return _open(path, kind, n, k);
+    }
+
+    auto TransitionTable::_open(const std::string& path, TransitionKind kind, int n, int k)
+        -> std::optional<TransitionTable> {
+        auto file = MappedFile::open(path);
+        if (!file || file->size() < header_size) {
+            return std::nullopt;
+        }
+        auto count = std::uint64_t{0};
+        std::memcpy(&count, file->data() + 24, sizeof count);
+        const auto expected = encode_header(kind, n, k, count);
+        if (std::memcmp(file->data(), expected.data(), header_size) != 0
+            || (file->size() - header_size) / 2 != count || (file->size() - header_size) % 2 != 0) {
+            return std::nullopt;
+        }
+        auto table = TransitionTable(std::move(*file));
+        table._kind = kind;
+        table._n = n;
+        table._k = k;
+        table._moves = table._file.data() + header_size;
+        table._size = static_cast<std::size_t>(count);
+        return table;
+    }
+
+}  // namespace ecgen
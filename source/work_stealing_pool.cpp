@@ -0,0 +1,233 @@
+#include <algorithm>  // for max
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <ecgen/work_stealing_pool.hpp>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace ecgen {
+
+    namespace {
+        struct CurrentWorker {
+            const WorkStealingPool* pool{nullptr};
+            int index{-1};
+        };
+
+        thread_local CurrentWorker current_worker{};
+
+        constexpr auto spin_rounds = 64;  // failed searches before a worker sleeps
+    }  // namespace
+
+    WorkStealingDeque::Ring::Ring(std::int64_t capacity)
+        : mask{capacity - 1},
+          slots{std::make_unique<std::atomic<PoolTask*>[]>(static_cast<std::size_t>(capacity))} {}
+
+    WorkStealingDeque::WorkStealingDeque(std::int64_t capacity) {
+        auto size = std::int64_t{1};
+        while (size < capacity) {
+            size <<= 1;
+        }
+        this->_rings.push_back(std::make_unique<Ring>(size));
+        this->_ring.store(this->_rings.back().get(), std::memory_order_relaxed);
+    }
+
+    void WorkStealingDeque::push(PoolTask* task) {
+        const auto bottom = this->_bottom.load(std::memory_order_relaxed);
+        const auto top = this->_top.load(std::memory_order_acquire);
+        auto* ring = this->_ring.load(std::memory_order_relaxed);
+        if (bottom - top > ring->capacity() - 1) {
+            auto bigger = std::make_unique<Ring>(ring->capacity() * 2);
+            for (auto i = top; i != bottom; ++i) {
+                bigger->put(i, ring->get(i));
+            }
+            ring = bigger.get();
+            this->_rings.push_back(std::move(bigger));
+            this->_ring.store(ring, std::memory_order_release);
+        }
+        ring->put(bottom, task);
+        this->_bottom.store(bottom + 1, std::memory_order_release);  // publish the task
+    }
+
+    auto WorkStealingDeque::pop() -> PoolTask* {
+        const auto bottom = this->_bottom.load(std::memory_order_relaxed) - 1;
+        auto* ring = this->_ring.load(std::memory_order_relaxed);
+        this->_bottom.store(bottom, std::memory_order_seq_cst);
+        auto top = this->_top.load(std::memory_order_seq_cst);
+        if (top > bottom) {  // empty
+            this->_bottom.store(bottom + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        auto* task = ring->get(bottom);
+        if (top == bottom) {  // last task: race against thieves
+            if (!this->_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                                    std::memory_order_relaxed)) {
+                task = nullptr;
+            }
+            this->_bottom.store(bottom + 1, std::memory_order_relaxed);
+        }
+        return task;
+    }
+
+    auto WorkStealingDeque::steal() -> PoolTask* {
+        auto top = this->_top.load(std::memory_order_seq_cst);
+        const auto bottom = this->_bottom.load(std::memory_order_seq_cst);
+        if (top >= bottom) {
+            return nullptr;
+        }
+        auto* task = this->_ring.load(std::memory_order_acquire)->get(top);
+        if (!this->_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                                std::memory_order_relaxed)) {
+            return nullptr;
+        }
+        return task;
+    }
+
+    auto WorkStealingDeque::empty() const noexcept -> bool {
+        return this->_top.load(std::memory_order_relaxed)
+               >= this->_bottom.load(std::memory_order_relaxed);
+    }
+
+    WorkStealingPool::WorkStealingPool(unsigned num_workers) {
+        if (num_workers == 0) {
+            num_workers = std::max(1U, std::thread::hardware_concurrency());
+        }
+        for (auto i = 0U; i != num_workers; ++i) {
+            this->_deques.push_back(std::make_unique<WorkStealingDeque>());
+        }
+        this->_threads.reserve(num_workers);
+        for (auto i = 0U; i != num_workers; ++i) {
+            this->_threads.emplace_back([this, i]() { this->_worker_loop(i); });
+        }
+    }
+
+    WorkStealingPool::~WorkStealingPool() {
+        {
+            auto lock = std::lock_guard<std::mutex>{this->_mutex};
+            this->_stop = true;
+        }
+        this->_cv.notify_all();
+        for (auto& thread : this->_threads) {
+            thread.join();
+        }
+    }
+
+    auto WorkStealingPool::worker_index() const noexcept -> int {
+        return current_worker.pool == this ? current_worker.index : -1;
+    }
+
+    void WorkStealingPool::_submit(PoolTask& task) {
+        {
+            auto lock = std::lock_guard<std::mutex>{this->_mutex};
+            this->_injected.push_back(&task);
+            this->_num_injected.fetch_add(1, std::memory_order_seq_cst);
+            this->_signal.fetch_add(1, std::memory_order_seq_cst);
+        }
+        this->_cv.notify_all();
+    }
+
+    void WorkStealingPool::_wait_root(const PoolTask& task) {
+        auto lock = std::unique_lock<std::mutex>{this->_mutex};
+        this->_done_cv.wait(lock, [&task]() { return task.done(); });
+    }
+
+    auto WorkStealingPool::_run_injected() -> bool {
+        if (this->_num_injected.load(std::memory_order_acquire) == 0) {
+            return false;
+        }
+        auto* task = static_cast<PoolTask*>(nullptr);
+        {
+            auto lock = std::lock_guard<std::mutex>{this->_mutex};
+            if (this->_injected.empty()) {
+                return false;
+            }
+            task = this->_injected.front();
+            this->_injected.pop_front();
+            this->_num_injected.fetch_sub(1, std::memory_order_relaxed);
+        }
+        task->execute();
+        {
+            // the waiter checks done() under the lock, so it cannot miss this
+            auto lock = std::lock_guard<std::mutex>{this->_mutex};
+        }
+        this->_done_cv.notify_all();
+        return true;
+    }
+
+    void WorkStealingPool::_wake() {
+        // a fork only needs a thief when somebody is asleep; if the owner
+        // finishes first it simply pops the task back. The fence orders the
+        // push before the load, pairing with the recheck in _worker_loop().
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (this->_num_sleeping.load(std::memory_order_seq_cst) > 0) {
+            {
+                auto lock = std::lock_guard<std::mutex>{this->_mutex};
+                this->_signal.fetch_add(1, std::memory_order_seq_cst);
+            }
+            this->_cv.notify_one();
+        }
+    }
+
+    void WorkStealingPool::_help_until(const PoolTask& task, std::size_t index) {
+        while (!task.done()) {
+            if (auto* other = this->_find_task(index)) {
+                other->execute();
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    auto WorkStealingPool::_find_task(std::size_t index) -> PoolTask* {
+        if (auto* task = this->_deques[index]->pop()) {
+            return task;
+        }
+        const auto num = this->_deques.size();
+        for (std::size_t k = 1; k < num; ++k) {
+            if (auto* task = this->_deques[(index + k) % num]->steal()) {
+                return task;
+            }
+        }
+        return nullptr;
+    }
+
+    void WorkStealingPool::_worker_loop(std::size_t index) {
+        current_worker = CurrentWorker{this, static_cast<int>(index)};
+        auto idle = 0;
+        while (true) {
+            const auto signal = this->_signal.load(std::memory_order_seq_cst);
+            if (auto* task = this->_find_task(index)) {
+                task->execute();
+                idle = 0;
+                continue;
+            }
+            if (this->_run_injected()) {
+                idle = 0;
+                continue;
+            }
+            if (++idle < spin_rounds) {
+                std::this_thread::yield();
+                continue;
+            }
+            idle = 0;
+            this->_num_sleeping.fetch_add(1, std::memory_order_seq_cst);
+            // a fork published before the increment may have seen nobody
+            // asleep and skipped the signal in _wake(), so look once more
+            if (auto* task = this->_find_task(index)) {
+                this->_num_sleeping.fetch_sub(1, std::memory_order_seq_cst);
+                task->execute();
+                continue;
+            }
+            auto lock = std::unique_lock<std::mutex>{this->_mutex};
+            this->_cv.wait(lock, [&]() {
+                return this->_stop || this->_signal.load(std::memory_order_seq_cst) != signal;
+            });
+            this->_num_sleeping.fetch_sub(1, std::memory_order_seq_cst);
+            if (this->_stop && this->_injected.empty()) {
+                return;
+            }
+        }
+    }
+
+}  // namespace ecgen
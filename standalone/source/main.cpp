@@ -1,53 +1,351 @@
-// #include <ecgen/greeter.h>
+#include <ecgen/combin.hpp>
+#include <ecgen/gray_code.hpp>
+#include <ecgen/perm.hpp>
+#include <ecgen/set_partition.hpp>
 #include <ecgen/version.h>
 
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>  // for exit
+#include <cstring>
 #include <cxxopts.hpp>
-#include <iostream>
 #include <string>
-#include <unordered_map>
+#include <utility>  // for move, swap
+#include <vector>
 
-auto main(int argc, char** argv) -> int {
-    // const std::unordered_map<std::string, ecgen::LanguageCode> languages{
-    //     {"en", ecgen::LanguageCode::EN},
-    //     {"de", ecgen::LanguageCode::DE},
-    //     {"es", ecgen::LanguageCode::ES},
-    //     {"fr", ecgen::LanguageCode::FR},
-    // };
+namespace {
+    /**
+     * @brief Buffered writer on top of a C stream
+     *
+     * Output is collected in a large buffer and handed to fwrite() in whole
+     * blocks; integers are formatted with std::to_chars, so no iostream or
+     * locale machinery is involved.
+     */
+    class Writer {
+      public:
+        explicit Writer(std::FILE* file, std::size_t capacity = std::size_t(1) << 20)
+            : _file{file}, _buffer(capacity) {}
+        Writer(const Writer&) = delete;
+        auto operator=(const Writer&) -> Writer& = delete;
+        ~Writer() { this->flush(); }
+
+        void put(char c) {
+            if (this->_pos == this->_buffer.size()) {
+                this->flush();
+            }
+            this->_buffer[this->_pos++] = c;
+        }
+
+        void write(const char* data, std::size_t len) {
+            if (len > this->_buffer.size() - this->_pos) {
+                this->flush();
+                if (len > this->_buffer.size()) {
+                    std::fwrite(data, 1, len, this->_file);
+                    return;
+                }
+            }
+            std::memcpy(this->_buffer.data() + this->_pos, data, len);
+            this->_pos += len;
+        }
+
+        void put_int(int value) {
+            constexpr std::size_t max_digits = 12;
+            if (this->_buffer.size() - this->_pos < max_digits) {
+                this->flush();
+            }
+            auto* first = this->_buffer.data() + this->_pos;
+            this->_pos += static_cast<std::size_t>(
+                std::to_chars(first, first + max_digits, value).ptr - first);
+        }
+
+        void flush() {
+            if (this->_pos != 0) {
+                std::fwrite(this->_buffer.data(), 1, this->_pos, this->_file);
+                this->_pos = 0;
+            }
+            std::fflush(this->_file);
+        }
+
+        auto ok() const -> bool { return std::ferror(this->_file) == 0; }
+
+      private:
+        std::FILE* _file;
+        std::vector<char> _buffer;
+        std::size_t _pos{0};
+    };
+
+    enum class Format { text, binary };
+
+    /**
+     * @brief Writes either the transitions or the full objects of a sequence
+     *
+     * In object mode the current object is kept together with its rendering:
+     * every entry owns a fixed-width field of the text line (or one byte of
+     * the binary record), so a transition rewrites one or two fields and the
+     * object is copied out with a single memcpy. In transition mode only the
+     * moves are written: one or two integers per line, or one byte each.
+     */
+    class Emitter {
+      public:
+        Emitter(Writer& out, Format format, bool objects, std::vector<int> init)
+            : _out{out}, _format{format}, _objects{objects}, _values{std::move(init)} {
+            if (!this->_objects) {
+                return;
+            }
+            const auto max = *std::max_element(this->_values.begin(), this->_values.end());
+            if (this->_format == Format::binary) {
+                this->_width = 1;
+                this->_stride = 1;
+                this->_line.assign(this->_values.size(), '\0');
+            } else {
+                for (auto rest = max; rest != 0; rest /= 10) {
+                    ++this->_width;
+                }
+                this->_width = std::max(this->_width, std::size_t(1));
+                // bit strings have no separators; otherwise the last one becomes '\n'
+                this->_stride = max < 2 ? 1 : this->_width + 1;
+                this->_line.assign(this->_values.size() * this->_stride, ' ');
+                if (this->_stride == this->_width) {
+                    this->_line.push_back('\n');
+                } else {
+                    this->_line.back() = '\n';
+                }
+            }
+            for (auto i = 0U; i != this->_values.size(); ++i) {
+                this->_render(i);
+            }
+        }
+
+        /// Write the initial object (object mode only)
+        void start() {
+            if (this->_objects) {
+                this->_out.write(this->_line.data(), this->_line.size());
+            }
+        }
+
+        void swap(int i, int j) {
+            if (this->_objects) {
+                std::swap(this->_values[std::size_t(i)], this->_values[std::size_t(j)]);
+                this->_render(std::size_t(i));
+                this->_render(std::size_t(j));
+            }
+        }
+
+        void assign(int i, int value) {
+            if (this->_objects) {
+                this->_values[std::size_t(i)] = value;
+                this->_render(std::size_t(i));
+            }
+        }
+
+        void flip(int i) {
+            if (this->_objects) {
+                this->_values[std::size_t(i)] ^= 1;
+                this->_render(std::size_t(i));
+            }
+        }
+
+        /// Finish a step whose move is the position `x`
+        void commit(int x) {
+            if (this->_objects) {
+                this->_out.write(this->_line.data(), this->_line.size());
+            } else if (this->_format == Format::binary) {
+                this->_out.put(static_cast<char>(x));
+            } else {
+                this->_out.put_int(x);
+                this->_out.put('\n');
+            }
+        }
+
+        /// Finish a step whose move is the pair (x, y)
+        void commit(int x, int y) {
+            if (this->_objects) {
+                this->_out.write(this->_line.data(), this->_line.size());
+            } else if (this->_format == Format::binary) {
+                this->_out.put(static_cast<char>(x));
+                this->_out.put(static_cast<char>(y));
+            } else {
+                this->_out.put_int(x);
+                this->_out.put(' ');
+                this->_out.put_int(y);
+                this->_out.put('\n');
+            }
+        }
+
+      private:
+        void _render(std::size_t i) {
+            const auto value = this->_values[i];
+            auto* field = this->_line.data() + i * this->_stride;
+            if (this->_format == Format::binary) {
+                *field = static_cast<char>(value);
+                return;
+            }
+            char digits[12];
+            const auto len = static_cast<std::size_t>(
+                std::to_chars(digits, digits + sizeof digits, value).ptr - digits);
+            std::memset(field, ' ', this->_width - len);  // right-aligned
+            std::memcpy(field + this->_width - len, digits, len);
+        }
+
+        Writer& _out;
+        Format _format;
+        bool _objects;
+        std::vector<int> _values;
+        std::vector<char> _line;  ///< rendering of the current object
+        std::size_t _width{0};
+        std::size_t _stride{0};
+    };
+
+    /// k-combinations of n as bit strings, revolving door order (Eades-McKay)
+    void run_comb(Emitter& emit, int n, int k) {
+        emit.start();
+        for (const auto& [x, y] : ecgen::emk_comb_gen(n, k)) {
+            emit.swap(x, y);
+            emit.commit(x, y);
+        }
+    }
+
+    /// Permutations of 0 .. n-1 by adjacent (sjt) or star (ehr) transpositions
+    void run_perm(Emitter& emit, int n, const std::string& algo) {
+        emit.start();
+        if (algo == "ehr") {
+            for (const int idx : ecgen::ehr_gen(n)) {
+                emit.swap(0, idx);
+                emit.commit(idx);
+            }
+            return;
+        }
+        if (n < 2) {
+            return;
+        }
+        // the last swap of sjt_gen() returns to the first permutation; drop it
+        auto pending = -1;
+        for (const int idx : ecgen::sjt_gen(n)) {
+            if (pending >= 0) {
+                emit.swap(pending, pending + 1);
+                emit.commit(pending);
+            }
+            pending = idx;
+        }
+    }
+
+    /// Set partitions of n elements into k blocks as restricted growth strings
+    void run_setpart(Emitter& emit, int n, int k) {
+        emit.start();
+        for (const auto& [x, y] : ecgen::set_partition_gen(n, k)) {
+            emit.assign(x - 1, y);  // the generator numbers the elements from 1
+            emit.commit(x - 1, y);
+        }
+    }
+
+    /// Binary reflected Gray code of length n
+    void run_gray(Emitter& emit, int n) {
+        emit.start();
+        for (const int idx : ecgen::brgc_gen(n)) {
+            emit.flip(idx);
+            emit.commit(idx);
+        }
+    }
+
+    /// The first object of each command (rg string 0^{n-k} 0 1 .. k-1 for setpart)
+    auto initial(const std::string& command, int n, int k) -> std::vector<int> {
+        auto init = std::vector<int>(std::size_t(n), 0);
+        if (command == "comb") {
+            std::fill_n(init.begin(), k, 1);
+        } else if (command == "perm") {
+            for (int i = 0; i != n; ++i) {
+                init[std::size_t(i)] = i;
+            }
+        } else if (command == "setpart") {
+            for (int i = 0; i != k; ++i) {
+                init[std::size_t(n - k + i)] = i;
+            }
+        }
+        return init;
+    }
+}  // namespace
 
-    cxxopts::Options options(*argv, "A program to welcome the world!");
+auto main(int argc, char** argv) -> int {
+    cxxopts::Options options(*argv, "Stream combinatorial objects in minimal change order");
 
-    // std::string language;
-    std::string name;
+    std::string command;
+    std::string algo;
+    std::string format;
+    int n = 0;
+    int k = 0;
 
     // clang-format off
   options.add_options()
     ("h,help", "Show help")
     ("v,version", "Print the current version number")
-    ("n,name", "Name to greet", cxxopts::value(name)->default_value("World"))
-    // ("l,lang", "Language code to use", cxxopts::value(language)->default_value("en"))
+    ("f,format", "Output format: text or binary", cxxopts::value(format)->default_value("text"))
+    ("o,objects", "Write the full objects instead of the transitions")
+    ("a,algo", "Permutation algorithm: sjt or ehr", cxxopts::value(algo)->default_value("sjt"))
+    ("command", "comb, perm, setpart or gray", cxxopts::value(command))
+    ("n", "Number of elements", cxxopts::value(n))
+    ("k", "Size of the combinations or number of blocks", cxxopts::value(k))
   ;
     // clang-format on
+    options.parse_positional({"command", "n", "k"});
+    options.positional_help("<comb n k | perm n | setpart n k | gray n>");
 
-    auto result = options.parse(argc, argv);
+    auto result = [&]() {
+        try {
+            return options.parse(argc, argv);
+        } catch (const cxxopts::exceptions::exception& e) {
+            std::fprintf(stderr, "%s\n", e.what());
+            std::exit(1);
+        }
+    }();
 
-    if (result["help"].as<bool>()) {
-        std::cout << options.help() << '\n';
+    if (result["version"].as<bool>()) {
+        std::printf("EcGen, version %s\n", ECGEN_VERSION);
         return 0;
     }
 
-    if (result["version"].as<bool>()) {
-        std::cout << "EcGen, version " << ECGEN_VERSION << '\n';
+    if (result["help"].as<bool>() || command.empty()) {
+        std::fputs(options.help().c_str(), stdout);
         return 0;
     }
 
-    // auto langIt = languages.find(language);
-    // if (langIt == languages.end()) {
-    //     std::cerr << "unknown language code: " << language << '\n';
-    //     return 1;
-    // }
-    //
-    // ecgen::EcGen ecgen(name);
-    // std::cout << ecgen.greet(langIt->second) << '\n';
+    const auto needs_k = command == "comb" || command == "setpart";
+    const auto valid_command = needs_k || command == "perm" || command == "gray";
+    if (!valid_command) {
+        std::fprintf(stderr, "unknown command: %s\n", command.c_str());
+        return 1;
+    }
+    if (n < 1 || (needs_k && (k < 0 || k > n || (command == "setpart" && k < 1)))) {
+        std::fprintf(stderr, "invalid arguments for %s: n = %d, k = %d\n", command.c_str(), n, k);
+        return 1;
+    }
+    if (algo != "sjt" && algo != "ehr") {
+        std::fprintf(stderr, "unknown algorithm: %s\n", algo.c_str());
+        return 1;
+    }
+    if (format != "text" && format != "binary") {
+        std::fprintf(stderr, "unknown format: %s\n", format.c_str());
+        return 1;
+    }
+    const auto binary = format == "binary";
+    if (binary && n > 256) {
+        std::fprintf(stderr, "binary records hold positions below 256\n");
+        return 1;
+    }
 
-    return 0;
+    auto out = Writer(stdout);
+    auto emit = Emitter(out, binary ? Format::binary : Format::text, result["objects"].as<bool>(),
+                        initial(command, n, k));
+    if (command == "comb") {
+        run_comb(emit, n, k);
+    } else if (command == "perm") {
+        run_perm(emit, n, algo);
+    } else if (command == "setpart") {
+        run_setpart(emit, n, k);
+    } else {
+        run_gray(emit, n);
+    }
+    out.flush();
+    return out.ok() ? 0 : 1;
 }
@@ -0,0 +1,111 @@
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <ecgen/backtrack.hpp>
+#include <ecgen/diff_cover.hpp>
+#include <vector>
+
+namespace {
+    auto queens(int n, bool stop_at_first = false) -> int {
+        auto solver = ecgen::Backtrack<std::uint8_t>(n, n);
+        auto count = 0;
+        solver.solve(
+            [](auto& s, int row) {
+                const auto col = s.value(row);
+                for (int r = 0; r != s.num_vars(); ++r) {
+                    const auto dist = r > row ? r - row : row - r;
+                    if (r != row
+                        && (!s.remove(r, col) || !s.remove(r, col + dist)
+                            || !s.remove(r, col - dist))) {
+                        return false;
+                    }
+                }
+                return true;
+            },
+            [&count, stop_at_first](const auto& s) {
+                ++count;
+                for (int r = 0; r != s.num_vars(); ++r) {
+                    CHECK(s.is_assigned(r));
+                }
+                return !stop_at_first;
+            });
+        // the trail is fully unwound after the search
+        for (int r = 0; r != n; ++r) {
+            CHECK_EQ(solver.domain(r).size(), std::size_t(n));
+        }
+        return count;
+    }
+}  // namespace
+
+TEST_CASE("backtrack mark and undo") {
+    auto solver = ecgen::Backtrack<>(2, 5);
+    const auto mark = solver.mark();
+    CHECK(solver.remove(0, 3));
+    CHECK(solver.remove(0, 3));  // already gone, nothing recorded
+    CHECK(solver.assign(1, 4));
+    CHECK_FALSE(solver.assign(0, 3));
+    CHECK_EQ(solver.domain(0).size(), 4U);
+    CHECK(solver.is_assigned(1));
+    CHECK_EQ(solver.value(1), 4);
+    CHECK_FALSE(solver.remove(1, 4));  // wipe-out
+    solver.undo(mark);
+    CHECK_EQ(solver.domain(0).size(), 5U);
+    CHECK_EQ(solver.domain(1).size(), 5U);
+    CHECK(solver.domain(0).contains(3));
+}
+
+TEST_CASE("backtrack n queens") {
+    CHECK_EQ(queens(4), 2);
+    CHECK_EQ(queens(6), 4);
+    CHECK_EQ(queens(8), 92);
+    CHECK_EQ(queens(8, true), 1);
+}
+
+TEST_CASE("backtrack difference covers") {
+    constexpr int N = 13;
+    constexpr int D = 4;
+    // x[0] = 0 < x[1] < ... < x[D-1] < N
+    auto solver = ecgen::Backtrack<>(D, N);
+    solver.assign(0, 0);
+    for (int i = 1; i != D; ++i) {
+        solver.remove(i, 0);
+    }
+    auto found = std::vector<std::vector<int>>{};
+    solver.solve(
+        [](auto& s, int var) {
+            const auto val = s.value(var);
+            for (int i = 0; i != s.num_vars(); ++i) {
+                for (int v = 0; v != s.domain_size(); ++v) {
+                    if ((i < var && v >= val) || (i > var && v <= val)) {
+                        if (!s.remove(i, v)) {
+                            return false;
+                        }
+                    }
+                }
+            }
+            return true;
+        },
+        [&found](const auto& s) {
+            auto set = std::vector<int>{};
+            for (int i = 0; i != s.num_vars(); ++i) {
+                set.push_back(s.value(i));
+            }
+            if (ecgen::DiffCoverSearch::is_difference_cover(N, set)) {
+                found.push_back(set);
+            }
+            return true;
+        });
+
+    auto expected = 0U;
+    for (int a = 1; a != N; ++a) {
+        for (int b = a + 1; b != N; ++b) {
+            for (int c = b + 1; c != N; ++c) {
+                expected += ecgen::DiffCoverSearch::is_difference_cover(N, {0, a, b, c}) ? 1U : 0U;
+            }
+        }
+    }
+    CHECK_EQ(found.size(), expected);
+    CHECK(std::find(found.begin(), found.end(), std::vector<int>{0, 1, 3, 9}) != found.end());
+    CHECK_GT(solver.nodes(), 0U);
+}
@@ -0,0 +1,80 @@
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <ecgen/bipart_cut.hpp>
+#include <ecgen/set_bipart.hpp>
+#include <tuple>
+#include <vector>
+
+namespace {
+    auto make_graph(int n) -> ecgen::CsrGraph<int> {
+        auto edges = std::vector<std::tuple<int, int, int>>{};
+        auto seed = 12345U;
+        for (int u = 0; u != n; ++u) {
+            for (int v = u + 1; v != n; ++v) {
+                seed = seed * 1103515245U + 12345U;
+                if ((seed >> 16) % 3 == 0) {
+                    edges.emplace_back(u, v, 1 + static_cast<int>((seed >> 8) % 7));
+                }
+            }
+        }
+        return ecgen::CsrGraph<int>::from_edges(n, edges);
+    }
+}  // namespace
+
+TEST_CASE("CSR graph cut weight") {
+    // a path 0 - 1 - 2 - 3 with weights 1, 2, 3
+    const auto graph
+        = ecgen::CsrGraph<int>::from_edges(4, {{0, 1, 1}, {1, 2, 2}, {2, 3, 3}});
+    CHECK_EQ(graph.num_vertices(), 4);
+    CHECK_EQ(graph.cut_weight(0b1000), 3);
+    CHECK_EQ(graph.cut_weight(0b1010), 6);
+    CHECK_EQ(graph.move_gain(0b1000, 2), -1);
+}
+
+TEST_CASE("CSR graph drops self-loops") {
+    const auto graph
+        = ecgen::CsrGraph<int>::from_edges(3, {{0, 1, 1}, {1, 1, 5}, {1, 2, 2}});
+    CHECK_EQ(graph.targets.size(), 4U);
+    CHECK_EQ(graph.cut_weight(0b010), 3);
+    CHECK_EQ(graph.move_gain(0b000, 1), 3);
+    const auto result = ecgen::bipart_cut_sweep(graph);
+    CHECK_EQ(result.cut, 1);
+    CHECK_EQ(result.mask, 0b110U);
+}
+
+TEST_CASE("bipart cut sweep skips graphs with fewer than 3 vertices") {
+    const auto graph = ecgen::CsrGraph<int>::from_edges(2, {{0, 1, 4}});
+    auto calls = 0;
+    const auto result
+        = ecgen::bipart_cut_sweep(graph, [&calls](std::uint64_t, int) { ++calls; });
+    CHECK_EQ(calls, 0);
+    CHECK_EQ(result.mask, 0U);
+}
+
+TEST_CASE("bipart cut sweep keeps the cut weight up to date") {
+    constexpr int N = 12;
+    const auto graph = make_graph(N);
+    size_t cnt = 0;
+    auto best = ecgen::BipartCut<int>{1 << 30, 0};
+    const auto result = ecgen::bipart_cut_sweep(graph, [&](std::uint64_t mask, int cut) {
+        ++cnt;
+        CHECK_EQ(cut, graph.cut_weight(mask));
+        if (cut < best.cut || (cut == best.cut && mask < best.mask)) {
+            best = ecgen::BipartCut<int>{cut, mask};
+        }
+    });
+    CHECK_EQ(cnt, ecgen::Stirling2nd2<N>());
+    CHECK_EQ(result.cut, best.cut);
+    CHECK_EQ(result.mask, best.mask);
+}
+
+TEST_CASE("bipart min cut in parallel agrees with the serial sweep") {
+    constexpr int N = 16;
+    const auto graph = make_graph(N);
+    const auto serial = ecgen::bipart_cut_sweep(graph);
+    const auto parallel = ecgen::bipart_min_cut(graph, 4);
+    CHECK_EQ(parallel.cut, serial.cut);
+    CHECK_EQ(parallel.mask, serial.mask);
+    CHECK_EQ(graph.cut_weight(parallel.mask), parallel.cut);
+}
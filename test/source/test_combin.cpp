@@ -1,7 +1,10 @@
 #include <doctest/doctest.h>
 
+#include <cstdint>
 #include <ecgen/combin.hpp>
+#include <set>
 #include <string>
+#include <vector>
 
 TEST_CASE("Generate all combinations by emk_comb_gen") {
     size_t cnt = 0;
@@ -19,3 +22,49 @@ TEST_CASE("Generate all combinations by emk") {
     }
     CHECK_EQ(cnt, ecgen::Combination<5, 3>());
 }
+
+TEST_CASE("Generate all combinations by emk_mask") {
+    auto lst = std::string("xxxx......");
+    auto masks = std::set<std::uint64_t>{};
+    auto emk = ecgen::emk(10, 4, lst);
+    auto it = emk.begin();
+    for (const auto& comb : ecgen::emk_mask(10, 4)) {
+        const auto& s = *it;
+        for (int i = 0; i != 10; ++i) {
+            CHECK_EQ(comb.test(i), s[static_cast<std::size_t>(i)] == 'x');
+        }
+        if (comb.added >= 0) {
+            CHECK(comb.test(comb.added));
+            CHECK_FALSE(comb.test(comb.removed));
+        }
+        CHECK_EQ(comb.count(), 4);
+        masks.insert(comb.words[0]);
+        ++it;
+    }
+    CHECK_EQ(masks.size(), ecgen::Combination<10, 4>());
+}
+
+TEST_CASE("Generate combinations of more than 64 elements by emk_mask") {
+    size_t cnt = 0;
+    auto last = ecgen::CombMask<2>{};
+    for (const auto& comb : ecgen::emk_mask<2>(70, 2)) {
+        CHECK_EQ(comb.count(), 2);
+        last = comb;
+        ++cnt;
+    }
+    CHECK_EQ(cnt, ecgen::Combination<70, 2>());
+    CHECK_NE(last.words[1], 0U);
+    cnt = 0;
+    for ([[maybe_unused]] const auto& comb : ecgen::emk_mask(70, 2)) {
+        ++cnt;  // does not fit in one word
+    }
+    CHECK_EQ(cnt, 0U);
+}
+
+TEST_CASE("Generate single-element combinations by emk_mask") {
+    auto masks = std::vector<std::uint64_t>{};
+    for (const auto& comb : ecgen::emk_mask(5, 1)) {
+        masks.push_back(comb.words[0]);
+    }
+    CHECK_EQ(masks, std::vector<std::uint64_t>{1, 2, 4, 8, 16});
+}
@@ -0,0 +1,75 @@
+#include <doctest/doctest.h>
+
+#include <algorithm>  // for fill_n
+#include <ecgen/combin.hpp>
+#include <ecgen/combin_range.hpp>
+#include <numeric>  // for accumulate
+#include <set>
+#include <vector>
+
+namespace {
+    auto binomial(int n, int k) -> size_t {
+        size_t result = 1;
+        for (int i = 1; i <= k; ++i) {
+            result = result * static_cast<size_t>(n - k + i) / static_cast<size_t>(i);
+        }
+        return result;
+    }
+}  // namespace
+
+TEST_CASE("Generate subsets with sizes in a range by comb_range_gen") {
+    constexpr int N = 8;
+    for (int k1 = 0; k1 <= N; ++k1) {
+        for (int k2 = k1; k2 <= N; ++k2) {
+            auto lst = std::vector<int>(N, 0);
+            std::fill_n(lst.begin(), k1, 1);
+            auto seen = std::set<std::vector<int>>{lst};
+            for (const auto& [removed, added] : ecgen::comb_range_gen(N, k1, k2)) {
+                CHECK((removed >= 0 || added >= 0));
+                if (removed >= 0) {
+                    CHECK_EQ(lst[static_cast<size_t>(removed)], 1);
+                    lst[static_cast<size_t>(removed)] = 0;
+                }
+                if (added >= 0) {
+                    CHECK_EQ(lst[static_cast<size_t>(added)], 0);
+                    lst[static_cast<size_t>(added)] = 1;
+                }
+                const auto weight = std::accumulate(lst.begin(), lst.end(), 0);
+                CHECK_GE(weight, k1);
+                CHECK_LE(weight, k2);
+                seen.insert(lst);
+            }
+            size_t expected = 0;
+            for (int k = k1; k <= k2; ++k) {
+                expected += binomial(N, k);
+            }
+            CHECK_EQ(seen.size(), expected);
+        }
+    }
+}
+
+TEST_CASE("Generate subsets of one size by comb_range_gen (swaps only)") {
+    size_t cnt = 1;
+    for (const auto& [removed, added] : ecgen::comb_range_gen(10, 4, 4)) {
+        CHECK_GE(removed, 0);
+        CHECK_GE(added, 0);
+        ++cnt;
+    }
+    CHECK_EQ(cnt, ecgen::Combination<10, 4>());
+}
+
+TEST_CASE("Generate subsets with sizes in a range by comb_range") {
+    size_t cnt = 0;
+    for (const auto& lst : ecgen::comb_range<std::vector<int>>(6, 2, 3)) {
+        const auto weight = std::accumulate(lst.begin(), lst.end(), 0);
+        CHECK((weight == 2 || weight == 3));
+        ++cnt;
+    }
+    CHECK_EQ(cnt, ecgen::Combination<6, 2>() + ecgen::Combination<6, 3>());
+
+    cnt = 0;
+    for ([[maybe_unused]] const auto& lst : ecgen::comb_range<std::vector<int>>(6, 4, 3)) {
+        ++cnt;
+    }
+    CHECK_EQ(cnt, 0);
+}
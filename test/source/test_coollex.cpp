@@ -0,0 +1,62 @@
+#include <doctest/doctest.h>
+
+#include <bit>
+#include <cstdint>
+#include <ecgen/combin.hpp>
+#include <ecgen/coollex.hpp>
+#include <set>
+#include <vector>
+
+TEST_CASE("cool-lex order of 5 choose 3") {
+    auto masks = std::vector<std::uint64_t>{};
+    for (const auto& comb : ecgen::coollex_comb(5, 3)) {
+        masks.push_back(comb.mask());
+    }
+    // bit strings b0..b4: 11100 01110 10110 11010 01101 10101 01011 00111 10011 11001
+    const auto expected = std::vector<std::uint64_t>{0b00111, 0b01110, 0b01101, 0b01011, 0b10110,
+                                                     0b10101, 0b11010, 0b11100, 0b11001, 0b10011};
+    CHECK_EQ(masks, expected);
+}
+
+TEST_CASE("cool-lex visits every combination once") {
+    auto masks = std::set<std::uint64_t>{};
+    auto lst = std::vector<int>(16, 0);
+    for (int i = 0; i != 5; ++i) {
+        lst[static_cast<std::size_t>(i)] = 1;
+    }
+    for (const auto& comb : ecgen::coollex_comb(16, 5)) {
+        CHECK_EQ(std::popcount(comb.mask()), 5);
+        CHECK(masks.insert(comb.mask()).second);
+        auto swaps = 0;
+        comb.for_each_swap([&](int out, int in) {
+            CHECK_EQ(lst[static_cast<std::size_t>(out)], 1);
+            CHECK_EQ(lst[static_cast<std::size_t>(in)], 0);
+            lst[static_cast<std::size_t>(out)] = 0;
+            lst[static_cast<std::size_t>(in)] = 1;
+            ++swaps;
+        });
+        CHECK(swaps <= 2);
+        for (int i = 0; i != 16; ++i) {
+            CHECK_EQ(lst[static_cast<std::size_t>(i)], int((comb.mask() >> i) & 1U));
+        }
+    }
+    CHECK_EQ(masks.size(), ecgen::Combination<16, 5>());
+}
+
+TEST_CASE("cool-lex edge cases") {
+    auto count = [](int n, int k) {
+        auto cnt = 0U;
+        for ([[maybe_unused]] const auto& comb : ecgen::coollex_comb(n, k)) {
+            ++cnt;
+        }
+        return cnt;
+    };
+    CHECK_EQ(count(6, 0), 1U);
+    CHECK_EQ(count(6, 6), 1U);
+    CHECK_EQ(count(6, 1), 6U);
+    CHECK_EQ(count(63, 1), 63U);
+    CHECK_EQ(count(63, 62), 63U);
+    CHECK_EQ(count(64, 2), 0U);
+    CHECK_EQ(count(65, 2), 0U);
+    CHECK_EQ(count(5, 6), 0U);
+}
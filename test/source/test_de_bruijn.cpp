@@ -0,0 +1,100 @@
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <ecgen/de_bruijn.hpp>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace {
+    auto read_all(ecgen::DeBruijnStream& stream, std::size_t chunk) -> std::vector<std::uint8_t> {
+        auto symbols = std::vector<std::uint8_t>{};
+        auto buffer = std::vector<std::uint8_t>(chunk);
+        while (const auto count = stream.read(buffer)) {
+            symbols.insert(symbols.end(), buffer.begin(), buffer.begin() + long(count));
+        }
+        return symbols;
+    }
+
+    auto sequence(int k, int n) -> std::vector<std::uint8_t> {
+        auto stream = ecgen::DeBruijnStream(k, n);
+        return read_all(stream, 7);
+    }
+
+    /// Every cyclic window of length n is distinct
+    auto all_windows_distinct(const std::vector<std::uint8_t>& seq, int n) -> bool {
+        auto windows = std::set<std::vector<std::uint8_t>>{};
+        for (std::size_t i = 0; i != seq.size(); ++i) {
+            auto window = std::vector<std::uint8_t>{};
+            for (std::size_t j = 0; j != std::size_t(n); ++j) {
+                window.push_back(seq[(i + j) % seq.size()]);
+            }
+            windows.insert(window);
+        }
+        return windows.size() == seq.size();
+    }
+}  // namespace
+
+TEST_CASE("de Bruijn sequences") {
+    CHECK_EQ(sequence(2, 3), std::vector<std::uint8_t>{0, 0, 0, 1, 0, 1, 1, 1});
+    CHECK_EQ(sequence(3, 2), std::vector<std::uint8_t>{0, 0, 1, 0, 2, 1, 1, 2, 2});
+    CHECK_EQ(sequence(4, 1), std::vector<std::uint8_t>{0, 1, 2, 3});
+    for (const auto& [k, n] : std::vector<std::pair<int, int>>{
+             {2, 1}, {2, 6}, {2, 12}, {3, 5}, {4, 4}, {5, 3}, {256, 2}}) {
+        const auto seq = sequence(k, n);
+        CHECK_EQ(seq.size(), ecgen::DeBruijnStream(k, n).length());
+        CHECK(all_windows_distinct(seq, n));
+    }
+}
+
+TEST_CASE("de Bruijn stream chunk sizes") {
+    const auto expected = sequence(3, 7);
+    for (const auto chunk : {1U, 2U, 64U, 5000U}) {
+        auto stream = ecgen::DeBruijnStream(3, 7);
+        CHECK_EQ(read_all(stream, chunk), expected);
+        CHECK_EQ(stream.position(), stream.length());
+    }
+}
+
+TEST_CASE("de Bruijn stream seeks") {
+    for (const auto& [k, n] : std::vector<std::pair<int, int>>{{2, 5}, {3, 4}, {4, 3}}) {
+        const auto expected = sequence(k, n);
+        for (std::size_t pos = 0; pos <= expected.size(); ++pos) {
+            auto stream = ecgen::DeBruijnStream(k, n);
+            REQUIRE(stream.seek(pos));
+            CHECK_EQ(stream.position(), pos);
+            const auto rest = read_all(stream, 3);
+            CHECK_EQ(rest, std::vector<std::uint8_t>(expected.begin() + long(pos), expected.end()));
+        }
+    }
+
+    const auto expected = sequence(2, 18);
+    auto stream = ecgen::DeBruijnStream(2, 18);
+    for (const auto pos : {262143U, 1U, 100000U, 131071U, 77777U, 262144U, 0U}) {
+        REQUIRE(stream.seek(pos));
+        auto buffer = std::vector<std::uint8_t>(100);
+        const auto count = stream.read(buffer);
+        CHECK_EQ(count, std::min<std::size_t>(100, expected.size() - pos));
+        CHECK(std::equal(buffer.begin(), buffer.begin() + long(count),
+                         expected.begin() + long(pos)));
+    }
+    CHECK_FALSE(stream.seek(262145U));
+
+    // the middle of a huge sequence
+    auto big = ecgen::DeBruijnStream(2, 40);
+    CHECK_EQ(big.length(), std::uint64_t{1} << 40);
+    REQUIRE(big.seek(std::uint64_t{1} << 39));
+    auto window = std::vector<std::uint8_t>(1000);
+    CHECK_EQ(big.read(window), 1000U);
+}
+
+TEST_CASE("de Bruijn stream with invalid arguments") {
+    for (const auto& [k, n] : std::vector<std::pair<int, int>>{{1, 3}, {257, 2}, {2, 0}, {2, 64}}) {
+        auto stream = ecgen::DeBruijnStream(k, n);
+        CHECK_EQ(stream.length(), 0U);
+        auto buffer = std::vector<std::uint8_t>(4);
+        CHECK_EQ(stream.read(buffer), 0U);
+    }
+    CHECK_EQ(ecgen::DeBruijnStream(2, 63).length(), std::uint64_t{1} << 63);
+}
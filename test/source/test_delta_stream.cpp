@@ -0,0 +1,120 @@
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <ecgen/combin.hpp>
+#include <ecgen/delta_stream.hpp>
+#include <ecgen/gray_code.hpp>
+#include <ecgen/perm.hpp>
+#include <ecgen/set_partition.hpp>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace {
+    auto temp_path(const std::string& name) -> std::string {
+        return (std::filesystem::temp_directory_path() / name).string();
+    }
+
+    /// All objects of a stream, replayed block by block
+    auto replay_all(const ecgen::DeltaStreamReader& reader) -> std::vector<std::vector<int>> {
+        auto objects = std::vector<std::vector<int>>{};
+        for (auto block = std::uint64_t{0}; block != reader.num_blocks(); ++block) {
+            reader.replay(block, [&objects](const auto& object) { objects.push_back(object); });
+        }
+        return objects;
+    }
+}  // namespace
+
+TEST_CASE("delta stream of combinations") {
+    const auto path = temp_path("ecgen_test_comb.ecd");
+    const auto initial = std::vector<int>{1, 1, 1, 1, 0, 0, 0, 0, 0, 0};
+    CHECK(ecgen::write_delta_stream(path, ecgen::DeltaMove::swap, initial,
+                                    ecgen::emk_comb_gen(10, 4), 7));
+
+    auto expected = std::vector<std::vector<int>>{};
+    for (const auto& object : ecgen::emk(10, 4, initial)) {
+        expected.push_back(object);
+    }
+
+    const auto reader = ecgen::DeltaStreamReader::open(path);
+    REQUIRE(reader.has_value());
+    CHECK_EQ(reader->move(), ecgen::DeltaMove::swap);
+    CHECK_EQ(reader->object_size(), 10U);
+    CHECK_EQ(reader->num_steps(), expected.size() - 1);
+    CHECK_EQ(reader->num_blocks(), (expected.size() - 1 + 6) / 7);
+    CHECK_EQ(replay_all(*reader), expected);
+    for (auto rank : {0U, 6U, 7U, 8U, 100U, 209U}) {
+        CHECK_EQ(reader->object_at(rank), expected[rank]);
+    }
+    CHECK(reader->object_at(210).empty());
+    std::remove(path.c_str());
+}
+
+TEST_CASE("delta stream of one-field moves") {
+    const auto path = temp_path("ecgen_test_gray.ecd");
+    CHECK(ecgen::write_delta_stream(path, ecgen::DeltaMove::flip, std::vector<int>(12, 0),
+                                    ecgen::brgc_gen(12), 64));
+    const auto reader = ecgen::DeltaStreamReader::open(path);
+    REQUIRE(reader.has_value());
+    const auto objects = replay_all(*reader);
+    REQUIRE_EQ(objects.size(), 4096U);
+    auto index = 0U;
+    for (const auto& object : ecgen::brgc<std::vector<int>>(12)) {
+        CHECK_EQ(objects[index++], object);
+    }
+
+    // star transpositions; 3-bit fields straddle the 64-bit words
+    CHECK(ecgen::write_delta_stream(path, ecgen::DeltaMove::swap_first,
+                                    {0, 1, 2, 3, 4, 5, 6}, ecgen::ehr_gen(7), 100));
+    const auto perms = ecgen::DeltaStreamReader::open(path);
+    REQUIRE(perms.has_value());
+    CHECK_EQ(perms->num_steps(), 5039U);
+    auto seen = replay_all(*perms);
+    std::sort(seen.begin(), seen.end());
+    CHECK(std::adjacent_find(seen.begin(), seen.end()) == seen.end());
+    std::remove(path.c_str());
+}
+
+TEST_CASE("delta stream of set partitions") {
+    const auto path = temp_path("ecgen_test_setpart.ecd");
+    auto writer = ecgen::DeltaStreamWriter::create(path, ecgen::DeltaMove::assign,
+                                                   {0, 0, 0, 0, 1, 2}, 5);
+    REQUIRE(writer.has_value());
+    for (const auto& [x, y] : ecgen::set_partition_gen(6, 3)) {
+        CHECK(writer->push(x - 1, y));
+    }
+    CHECK_FALSE(writer->push(6, 0));  // out of range, not written
+    CHECK(writer->close());
+
+    const auto reader = ecgen::DeltaStreamReader::open(path);
+    REQUIRE(reader.has_value());
+    const auto objects = replay_all(*reader);
+    CHECK_EQ(objects.size(), ecgen::Stirling2nd<6, 3>());
+    CHECK_EQ(reader->object_at(objects.size() - 1), objects.back());
+    std::remove(path.c_str());
+}
+
+TEST_CASE("delta stream edge cases") {
+    const auto path = temp_path("ecgen_test_edge.ecd");
+    CHECK_FALSE(ecgen::DeltaStreamWriter::create(path, ecgen::DeltaMove::swap, {}).has_value());
+    {
+        auto writer = ecgen::DeltaStreamWriter::create(path, ecgen::DeltaMove::swap, {1, 0});
+        REQUIRE(writer.has_value());
+    }  // closed by the destructor
+    const auto reader = ecgen::DeltaStreamReader::open(path);
+    REQUIRE(reader.has_value());
+    CHECK_EQ(reader->num_steps(), 0U);
+    CHECK_EQ(reader->num_blocks(), 1U);
+    CHECK_EQ(replay_all(*reader), std::vector<std::vector<int>>{{1, 0}});
+
+    {
+        auto file = std::ofstream(path, std::ios::binary | std::ios::trunc);
+        file << "ECGDELTA but not really a delta stream file";
+    }
+    CHECK_FALSE(ecgen::DeltaStreamReader::open(path).has_value());
+    std::remove(path.c_str());
+    CHECK_FALSE(ecgen::DeltaStreamReader::open(path).has_value());
+}
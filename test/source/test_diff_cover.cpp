@@ -0,0 +1,194 @@
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <ecgen/diff_cover.hpp>
+#include <numeric>
+#include <set>
+#include <vector>
+
+namespace {
+    /// the units mod n
+    auto units_of(int n) -> std::vector<int> {
+        auto units = std::vector<int>{};
+        for (auto u = 1; u != n; ++u) {
+            if (std::gcd(u, n) == 1) {
+                units.push_back(u);
+            }
+        }
+        return units;
+    }
+
+    /// the smallest sorted image of a set under x -> u (x - s) for s in the set
+    auto class_of(int n, const std::vector<int>& set, const std::vector<int>& units)
+        -> std::vector<int> {
+        auto best = std::vector<int>{};
+        for (const auto u : units) {
+            for (const auto s : set) {
+                auto rot = std::vector<int>{};
+                for (const auto x : set) {
+                    rot.push_back(((x - s) * u % n + n) % n);
+                }
+                std::sort(rot.begin(), rot.end());
+                if (best.empty() || rot < best) {
+                    best = rot;
+                }
+            }
+        }
+        return best;
+    }
+
+    /// number of classes of d-element difference covers of Z_n under
+    /// x -> u x + c for the given multipliers u (rotations only by default)
+    auto brute_force_classes(int n, int d, const std::vector<int>& units = {1}) -> std::size_t {
+        auto classes = std::set<std::vector<int>>{};
+        auto set = std::vector<int>(static_cast<std::size_t>(d));
+        auto mask = std::vector<bool>(static_cast<std::size_t>(n - 1), false);
+        std::fill(mask.begin(), mask.begin() + d - 1, true);
+        do {  // subsets {0} + (d-1) elements of 1..n-1
+            set[0] = 0;
+            auto k = 1U;
+            for (auto i = 0; i != n - 1; ++i) {
+                if (mask[static_cast<std::size_t>(i)]) {
+                    set[k++] = i + 1;
+                }
+            }
+            if (ecgen::DiffCoverSearch::is_difference_cover(n, set)) {
+                classes.insert(class_of(n, set, units));
+            }
+        } while (std::prev_permutation(mask.begin(), mask.end()));
+        return classes.size();
+    }
+}  // namespace
+
+TEST_CASE("diff cover find first") {
+    auto search = ecgen::DiffCoverSearch(13, 4);
+    const auto cover = search.find_first(2);
+    REQUIRE(cover.has_value());
+    CHECK_EQ(cover->size(), 4U);
+    CHECK_EQ(cover->back(), 13);
+    CHECK(ecgen::DiffCoverSearch::is_difference_cover(13, *cover));
+}
+
+TEST_CASE("diff cover find all matches brute force") {
+    for (const auto& [n, d] : std::vector<std::pair<int, int>>{{7, 3}, {13, 4}, {16, 6}, {20, 6}}) {
+        for (const auto workers : {1U, 4U}) {
+            auto search = ecgen::DiffCoverSearch(n, d);
+            const auto covers = search.find_all(workers);
+            INFO("n = ", n, ", d = ", d, ", workers = ", workers);
+            CHECK_EQ(covers.size(), brute_force_classes(n, d));
+            for (const auto& cover : covers) {
+                CHECK(ecgen::DiffCoverSearch::is_difference_cover(n, cover));
+            }
+        }
+    }
+}
+
+TEST_CASE("diff cover symmetry classes") {
+    for (const auto& [n, d] : std::vector<std::pair<int, int>>{{13, 4}, {16, 6}, {20, 6}}) {
+        const auto units = units_of(n);
+        INFO("n = ", n, ", d = ", d);
+        auto search = ecgen::DiffCoverSearch(n, d);
+        search.set_symmetry(ecgen::DiffCoverSymmetry::dihedral);
+        CHECK_EQ(search.find_all(2).size(), brute_force_classes(n, d, {1, n - 1}));
+        search.set_symmetry(ecgen::DiffCoverSymmetry::affine);
+        const auto covers = search.find_all(2);
+        CHECK_EQ(covers.size(), brute_force_classes(n, d, units));
+        const auto& stats = search.stats();
+        CHECK_EQ(stats.covers - stats.non_canonical, covers.size());
+        CHECK_EQ(stats.covers, brute_force_classes(n, d));
+    }
+}
+
+TEST_CASE("diff cover stats and bounds") {
+    auto search = ecgen::DiffCoverSearch(20, 6);
+    const auto expected = search.find_all(1).size();
+    const auto stats = search.stats();
+    REQUIRE_EQ(stats.nodes.size(), 6U);
+    CHECK_EQ(stats.nodes[0], 0U);
+    CHECK_GT(stats.nodes[1], 0U);
+    for (std::size_t t = 0; t != stats.nodes.size(); ++t) {
+        CHECK_LE(stats.pruned[t], stats.nodes[t]);
+    }
+
+    // the stats do not depend on how the tree was split
+    search.find_all(4);
+    CHECK_EQ(search.stats().nodes, stats.nodes);
+
+    // a bound that only inspects the prefix keeps every cover
+    auto calls = std::atomic<int>{0};
+    search.set_bound([&calls](int t, const std::vector<int>& a, int covered) {
+        ++calls;
+        return t >= 1 && a[0] == 0 && a[static_cast<std::size_t>(t)] < 20 && covered > 0;
+    });
+    CHECK_EQ(search.find_all(1).size(), expected);
+    CHECK_GT(calls.load(), 0);
+
+    // the built-in bound as a table; a stricter one loses covers
+    search.set_bound({});
+    search.set_min_coverage({0, 0, 0, 1, 5, 10});
+    CHECK_EQ(search.find_all(1).size(), expected);
+    CHECK_EQ(search.stats().nodes, stats.nodes);
+    search.set_min_coverage({0, 10});
+    CHECK(search.find_all(1).empty());
+}
+
+TEST_CASE("diff cover without solutions") {
+    auto search = ecgen::DiffCoverSearch(14, 4);  // 14 > 4 * 3 + 1
+    CHECK_FALSE(search.find_first().has_value());
+    CHECK(search.find_all().empty());
+    CHECK_FALSE(ecgen::DiffCoverSearch::is_difference_cover(12, {0, 1, 2, 6}));
+}
+
+namespace {
+    auto total_nodes(const ecgen::DiffCoverStats& stats) -> std::uint64_t {
+        return std::accumulate(stats.nodes.begin(), stats.nodes.end(), std::uint64_t{0});
+    }
+}  // namespace
+
+TEST_CASE("diff cover cancellation") {
+    auto search = ecgen::DiffCoverSearch(40, 8);
+    const auto all = search.find_all(2);
+    const auto full = total_nodes(search.stats());
+    CHECK_GT(full, 1000U);
+
+    // a cancel() before the search is kept, and only clears on return
+    search.cancel();
+    CHECK(search.find_all(2).empty());
+    CHECK_EQ(total_nodes(search.stats()), 0U);
+    CHECK_EQ(search.find_all(2), all);
+
+    // cancelled once from inside the search
+    auto calls = std::atomic<int>{0};
+    search.set_bound([&](int, const std::vector<int>&, int) {
+        if (++calls == 100) {
+            search.cancel();
+        }
+        return true;
+    });
+    const auto covers = search.find_all(2);
+    CHECK_LT(total_nodes(search.stats()), full);
+    CHECK_LT(covers.size(), all.size());
+    for (const auto& cover : covers) {
+        CHECK(ecgen::DiffCoverSearch::is_difference_cover(40, cover));
+    }
+}
+
+TEST_CASE("diff cover symmetry filters complete covers") {
+    const auto n = 40;
+    auto search = ecgen::DiffCoverSearch(n, 8);
+    const auto all = search.find_all(2);
+    const auto rotation = search.stats();
+
+    auto classes = std::set<std::vector<int>>{};
+    for (const auto& cover : all) {
+        classes.insert(class_of(n, cover, units_of(n)));
+    }
+    search.set_symmetry(ecgen::DiffCoverSymmetry::affine);
+    CHECK_EQ(search.find_all(2).size(), classes.size());
+    // the symmetry check runs on complete covers only, so the tree is the same
+    const auto stats = search.stats();
+    CHECK_EQ(stats.nodes, rotation.nodes);
+    CHECK_EQ(stats.covers, rotation.covers);
+}
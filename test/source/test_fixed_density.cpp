@@ -0,0 +1,116 @@
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <ecgen/diff_cover.hpp>
+#include <ecgen/fixed_density.hpp>
+#include <ecgen/necklace.hpp>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace {
+    using Words = std::vector<std::vector<int>>;
+
+    auto to_word(int n, std::span<const int> positions, std::span<const int> symbols)
+        -> std::vector<int> {
+        auto word = std::vector<int>(static_cast<std::size_t>(n), 0);
+        for (std::size_t i = 0; i != positions.size(); ++i) {
+            word[static_cast<std::size_t>(positions[i] - 1)] = symbols[i];
+        }
+        return word;
+    }
+
+    auto collect(int n, int d, int k, ecgen::NecklaceKind kind) -> Words {
+        auto words = Words{};
+        ecgen::FixedDensityNecklaces(n, d, k, kind)
+            .run([](std::span<const int>, std::span<const int>) { return true; },
+                 [&](std::span<const int> positions, std::span<const int> symbols) {
+                     words.push_back(to_word(n, positions, symbols));
+                     return true;
+                 });
+        std::sort(words.begin(), words.end());
+        return words;
+    }
+
+    /// The FKM words with exactly d nonzero symbols
+    auto filtered(int n, int d, int k, ecgen::NecklaceKind kind) -> Words {
+        auto words = Words{};
+        ecgen::Necklaces(n, k, kind).run([&](std::span<const int> word) {
+            if (std::count(word.begin(), word.end(), 0) == n - d) {
+                words.emplace_back(word.begin(), word.end());
+            }
+            return true;
+        });
+        return words;
+    }
+}  // namespace
+
+TEST_CASE("fixed-density necklaces match the filtered FKM words") {
+    for (const auto kind : {ecgen::NecklaceKind::necklace, ecgen::NecklaceKind::lyndon}) {
+        for (auto k = 2; k != 5; ++k) {
+            for (auto n = 1; n != 9; ++n) {
+                for (auto d = 0; d <= n; ++d) {
+                    CHECK_EQ(collect(n, d, k, kind), filtered(n, d, k, kind));
+                }
+            }
+        }
+    }
+    CHECK_EQ(collect(4, 0, 1, ecgen::NecklaceKind::necklace), Words{{0, 0, 0, 0}});
+    CHECK(collect(4, 5, 2, ecgen::NecklaceKind::necklace).empty());
+    CHECK(collect(4, 2, 2, ecgen::NecklaceKind::prenecklace).empty());
+}
+
+TEST_CASE("fixed-density necklaces skip rejected prefixes") {
+    // no two nonzero symbols next to each other among a[1..d-1]
+    const auto spaced = [](std::span<const int> positions) {
+        for (std::size_t i = 1; i < positions.size(); ++i) {
+            if (positions[i] - positions[i - 1] == 1) {
+                return false;
+            }
+        }
+        return true;
+    };
+    auto all = Words{};
+    auto kept = Words{};
+    auto gen = ecgen::FixedDensityNecklaces(16, 5);
+    gen.run([](std::span<const int>, std::span<const int>) { return true; },
+            [&](std::span<const int> positions, std::span<const int> symbols) {
+                if (spaced(positions.first(positions.size() - 1))) {
+                    all.push_back(to_word(16, positions, symbols));
+                }
+                return true;
+            });
+    CHECK_EQ(gen.pruned(), 0U);
+    gen.run([&](std::span<const int> positions, std::span<const int>) { return spaced(positions); },
+            [&](std::span<const int> positions, std::span<const int> symbols) {
+                kept.push_back(to_word(16, positions, symbols));
+                return true;
+            });
+    CHECK(gen.pruned() > 0);
+    CHECK_EQ(gen.leaves(), kept.size());
+    CHECK_EQ(kept, all);
+
+    auto count = 0;
+    CHECK_FALSE(gen.run([](std::span<const int>, std::span<const int>) { return true; },
+                        [&count](std::span<const int>, std::span<const int>) {
+                            return ++count < 7;
+                        }));
+    CHECK_EQ(count, 7);
+}
+
+TEST_CASE("fixed-density necklaces find the difference covers") {
+    for (const auto& [n, d] : std::vector<std::pair<int, int>>{{13, 4}, {21, 5}, {18, 5}}) {
+        auto covers = Words{};
+        ecgen::FixedDensityNecklaces(n, d).run(
+            [](std::span<const int>, std::span<const int>) { return true; },
+            [&](std::span<const int> positions, std::span<const int>) {
+                const auto set = std::vector<int>(positions.begin(), positions.end());
+                if (ecgen::DiffCoverSearch::is_difference_cover(n, set)) {
+                    covers.push_back(set);
+                }
+                return true;
+            });
+        std::sort(covers.begin(), covers.end());
+        CHECK_EQ(covers, ecgen::DiffCoverSearch(n, d).find_all(2));
+    }
+}
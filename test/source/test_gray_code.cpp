@@ -3,6 +3,7 @@
 #include <algorithm>  // for fill_n
 #include <ecgen/combin.hpp>
 #include <ecgen/gray_code.hpp>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -118,3 +119,45 @@ TEST_CASE("Generate all combinations (even)") {
     }
     CHECK_EQ(cnt, ecgen::Combination<N, K>());
 }
+
+TEST_CASE("Generate mixed-radix Gray code by mixed_radix_gray_gen") {
+    const auto radices = std::vector<int>{3, 1, 4, 2};
+    auto lst = std::vector<int>(radices.size(), 0);
+    auto seen = std::set<std::vector<int>>{lst};
+    for (const auto& [coord, delta] : ecgen::mixed_radix_gray_gen(radices)) {
+        CHECK((delta == 1 || delta == -1));
+        CHECK_NE(coord, 1);
+        lst[static_cast<size_t>(coord)] += delta;
+        CHECK_GE(lst[static_cast<size_t>(coord)], 0);
+        CHECK_LT(lst[static_cast<size_t>(coord)], radices[static_cast<size_t>(coord)]);
+        seen.insert(lst);
+    }
+    CHECK_EQ(seen.size(), 3 * 4 * 2);
+}
+
+TEST_CASE("Generate mixed-radix Gray code (binary radices match brgc_gen)") {
+    auto brgc = std::vector<int>{};
+    for (auto idx : ecgen::brgc_gen(5)) {
+        brgc.push_back(idx);
+    }
+    auto mixed = std::vector<int>{};
+    for (const auto& [coord, delta] : ecgen::mixed_radix_gray_gen({2, 2, 2, 2, 2})) {
+        mixed.push_back(coord);
+    }
+    CHECK_EQ(mixed, brgc);
+}
+
+TEST_CASE("Generate mixed-radix tuples") {
+    size_t cnt = 0;
+    for (const auto& lst : ecgen::mixed_radix_gray<std::vector<int>>({3, 2})) {
+        CHECK_EQ(lst.size(), 2);
+        ++cnt;
+    }
+    CHECK_EQ(cnt, 6);
+
+    cnt = 0;
+    for ([[maybe_unused]] const auto& lst : ecgen::mixed_radix_gray<std::vector<int>>({3, 0})) {
+        ++cnt;
+    }
+    CHECK_EQ(cnt, 0);  // a radix of 0 leaves no tuples
+}
@@ -0,0 +1,187 @@
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <ecgen/gray_code.hpp>
+#include <ecgen/integer_partition.hpp>
+#include <numeric>
+#include <set>
+#include <span>
+#include <vector>
+
+namespace {
+    /// The number of compositions of n into k parts in [lo, hi]
+    auto count_bounded(int n, int k, int hi, int lo) -> std::size_t {
+        if (k == 0) {
+            return n == 0 ? 1 : 0;
+        }
+        auto count = std::size_t{0};
+        for (auto x = lo; x <= hi && x <= n; ++x) {
+            count += count_bounded(n - x, k - 1, hi, lo);
+        }
+        return count;
+    }
+
+    /// The number of partitions of n with parts at most k
+    auto count_partitions(int n, int k) -> std::size_t {
+        if (n == 0) {
+            return 1;
+        }
+        auto count = std::size_t{0};
+        for (auto x = 1; x <= k && x <= n; ++x) {
+            count += count_partitions(n - x, x);
+        }
+        return count;
+    }
+
+    auto expand(const ecgen::IntegerPartitions& part) -> std::vector<int> {
+        auto parts = std::vector<int>{};
+        for (std::size_t i = 0; i != part.values().size(); ++i) {
+            parts.insert(parts.end(), std::size_t(part.counts()[i]), part.values()[i]);
+        }
+        return parts;
+    }
+}  // namespace
+
+TEST_CASE("compositions follow the binary reflected Gray code") {
+    for (auto n = 1; n <= 10; ++n) {
+        auto seen = std::set<std::vector<int>>{};
+        auto cuts = std::vector<int>{};
+        for (const int j : ecgen::brgc_gen(n - 1)) {
+            cuts.push_back(j);
+        }
+        auto prev = std::vector<int>{};
+        auto step = std::size_t{0};
+        for (const auto& comp : ecgen::Compositions(n)) {
+            const auto parts = std::vector<int>(comp.parts().begin(), comp.parts().end());
+            CHECK_EQ(std::accumulate(parts.begin(), parts.end(), 0), n);
+            CHECK(std::all_of(parts.begin(), parts.end(), [](int x) { return x > 0; }));
+            if (step == 0) {
+                CHECK_EQ(parts, std::vector<int>{n});
+                CHECK_EQ(comp.index(), -1);
+            } else {
+                const auto i = std::size_t(comp.index());
+                // the toggled cut sits after unit cuts[step-1] + 1
+                const auto before = std::accumulate(parts.begin(), parts.begin() + long(i), 0);
+                if (comp.split()) {
+                    REQUIRE_EQ(parts.size(), prev.size() + 1);
+                    CHECK_EQ(parts[i] + parts[i + 1], prev[i]);
+                    CHECK_EQ(before + parts[i], cuts[step - 1] + 1);
+                } else {
+                    REQUIRE_EQ(parts.size() + 1, prev.size());
+                    CHECK_EQ(parts[i], prev[i] + prev[i + 1]);
+                    CHECK_EQ(before + prev[i], cuts[step - 1] + 1);
+                }
+            }
+            seen.insert(parts);
+            prev = parts;
+            ++step;
+        }
+        CHECK_EQ(step, std::size_t{1} << (n - 1));
+        CHECK_EQ(seen.size(), step);
+    }
+}
+
+TEST_CASE("compositions of 0 and invalid sizes") {
+    auto count = 0;
+    for (const auto& comp : ecgen::Compositions(0)) {
+        CHECK(comp.parts().empty());
+        ++count;
+    }
+    CHECK_EQ(count, 1);
+    CHECK(ecgen::Compositions(-1).empty());
+    CHECK(ecgen::Compositions(65).empty());
+}
+
+TEST_CASE("bounded compositions move one unit per step") {
+    for (auto lo = 0; lo <= 1; ++lo) {
+        for (auto hi = lo; hi <= lo + 5; ++hi) {
+            for (auto k = 1; k <= 5; ++k) {
+                for (auto n = k * lo; n <= k * hi; ++n) {
+                    auto seen = std::set<std::vector<int>>{};
+                    auto prev = std::vector<int>{};
+                    auto gen = ecgen::BoundedCompositions(n, k, hi, lo);
+                    gen.run([&](std::span<const int> view, int from, int to) {
+                        const auto parts = std::vector<int>(view.begin(), view.end());
+                        CHECK(std::all_of(parts.begin(), parts.end(),
+                                          [&](int x) { return lo <= x && x <= hi; }));
+                        if (prev.empty()) {
+                            CHECK_EQ(from, -1);
+                        } else {
+                            auto moved = prev;
+                            --moved[std::size_t(from)];
+                            ++moved[std::size_t(to)];
+                            CHECK_EQ(parts, moved);
+                        }
+                        seen.insert(parts);
+                        prev = parts;
+                        return true;
+                    });
+                    CHECK_EQ(seen.size(), count_bounded(n, k, hi, lo));
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("bounded compositions stop early and reject empty ranges") {
+    auto count = 0;
+    auto gen = ecgen::BoundedCompositions(12, 6, 4);
+    CHECK_FALSE(gen.run([&](std::span<const int>, int, int) { return ++count < 10; }));
+    CHECK_EQ(count, 10);
+
+    auto visits = 0;
+    const auto visit = [&visits](std::span<const int>, int, int) { return ++visits > 0; };
+    CHECK(ecgen::BoundedCompositions(13, 3, 4).run(visit));
+    CHECK(ecgen::BoundedCompositions(2, 3, 4, 1).run(visit));
+    CHECK(ecgen::BoundedCompositions(3, 0, 4).run(visit));
+    CHECK_EQ(visits, 0);
+}
+
+TEST_CASE("integer partitions in reverse lexicographic order") {
+    for (auto n = 1; n <= 16; ++n) {
+        for (auto k = 1; k <= n + 1; ++k) {
+            auto gen = ecgen::IntegerPartitions(n, k);
+            auto mult = std::vector<int>(std::size_t(n) + 1, 0);
+            auto prev = std::vector<int>{};
+            auto count = std::size_t{0};
+            for (const auto& part : gen) {
+                const auto parts = expand(part);
+                CHECK_EQ(std::accumulate(parts.begin(), parts.end(), 0), n);
+                CHECK(std::is_sorted(parts.rbegin(), parts.rend()));
+                CHECK_LE(parts.front(), k);
+                CHECK(parts < prev || prev.empty());
+                CHECK_LE(part.changes().size(), 4U);
+                for (const auto& [value, change] : part.changes()) {
+                    mult[std::size_t(value)] += change;
+                }
+                for (auto x = 1; x <= std::min(n, k); ++x) {
+                    const auto copies = std::count(parts.begin(), parts.end(), x);
+                    CHECK_EQ(mult[std::size_t(x)], copies);
+                    CHECK_EQ(part.multiplicity(x), copies);
+                }
+                prev = parts;
+                ++count;
+            }
+            CHECK_EQ(count, count_partitions(n, k));
+            CHECK_EQ(prev, std::vector<int>(std::size_t(n), 1));
+        }
+    }
+}
+
+TEST_CASE("integer partitions of 0 and invalid sizes") {
+    auto count = 0;
+    for (const auto& part : ecgen::IntegerPartitions(0)) {
+        CHECK(part.values().empty());
+        ++count;
+    }
+    CHECK_EQ(count, 1);
+    CHECK(ecgen::IntegerPartitions(-1).empty());
+    CHECK(ecgen::IntegerPartitions(5, 0).empty());
+    auto gen = ecgen::IntegerPartitions(30);
+    auto p = std::size_t{0};
+    for (auto it = gen.begin(); it != gen.end(); ++it) {
+        ++p;
+    }
+    CHECK_EQ(p, 5604U);
+}
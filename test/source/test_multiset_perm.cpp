@@ -0,0 +1,97 @@
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <ecgen/multiset_perm.hpp>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace {
+    auto arrangement(const ecgen::MultisetPerm& perm) -> std::vector<int> {
+        auto values = std::vector<int>{};
+        perm.for_each([&values](int value) { values.push_back(value); });
+        return values;
+    }
+
+    /// The number of distinct arrangements by next_permutation
+    auto brute_force(const std::vector<int>& counts) -> std::size_t {
+        auto items = std::vector<int>{};
+        for (std::size_t v = 0; v != counts.size(); ++v) {
+            items.insert(items.end(), std::size_t(counts[v]), int(v));
+        }
+        auto count = std::size_t{0};
+        do {
+            ++count;
+        } while (std::next_permutation(items.begin(), items.end()));
+        return count;
+    }
+}  // namespace
+
+TEST_CASE("multiset permutations visit every arrangement once") {
+    const auto cases = std::vector<std::vector<int>>{
+        {1, 2}, {2, 2}, {3, 1, 2}, {1, 1, 1, 1, 1}, {4, 0, 3}, {2, 3, 2, 1}, {6}, {1}};
+    for (const auto& counts : cases) {
+        auto seen = std::set<std::vector<int>>{};
+        auto gen = ecgen::MultisetPerm(counts);
+        auto first = true;
+        auto count = std::size_t{0};
+        for (const auto& perm : gen) {
+            ++count;
+            const auto values = arrangement(perm);
+            if (first) {
+                CHECK(std::is_sorted(values.rbegin(), values.rend()));
+                CHECK_EQ(perm.shift(), 0);
+                first = false;
+            }
+            CHECK_EQ(perm.front(), values.front());
+            seen.insert(values);
+        }
+        CHECK_EQ(count, brute_force(counts));
+        CHECK_EQ(seen.size(), count);
+    }
+}
+
+TEST_CASE("multiset permutations change by a prefix shift") {
+    auto counts = std::vector{2, 1, 3};
+    auto gen = ecgen::MultisetPerm(counts);
+    auto prev = std::vector<int>{};
+    auto steps = 0;
+    for (const auto& perm : gen) {
+        const auto values = arrangement(perm);
+        if (!prev.empty()) {
+            const auto r = std::size_t(perm.shift());
+            REQUIRE(r > 0);
+            REQUIRE(r < prev.size());
+            std::rotate(prev.begin(), prev.begin() + long(r), prev.begin() + long(r) + 1);
+            CHECK_EQ(prev, values);
+            ++steps;
+        }
+        prev = values;
+    }
+    CHECK_EQ(steps, 59);  // 6! / (2! 1! 3!) - 1
+    CHECK_FALSE(gen.next());
+}
+
+TEST_CASE("multiset permutations of a container") {
+    auto word = std::string("banana");
+    auto seen = std::set<std::string>{};
+    for (const auto& arrangement : ecgen::multiset_perm(word)) {
+        seen.insert(arrangement);
+    }
+    CHECK_EQ(seen.size(), 60U);  // 6! / (3! 2!)
+    CHECK(seen.count("aaabnn") == 1);
+
+    auto empty = std::vector<int>{};
+    auto count = 0;
+    for ([[maybe_unused]] const auto& arrangement : ecgen::multiset_perm(empty)) {
+        ++count;
+    }
+    CHECK_EQ(count, 1);
+
+    auto none = 0;
+    const auto invalid = std::vector{2, -1};
+    for ([[maybe_unused]] const auto& perm : ecgen::MultisetPerm(invalid)) {
+        ++none;
+    }
+    CHECK_EQ(none, 0);
+}
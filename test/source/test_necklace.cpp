@@ -0,0 +1,108 @@
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <ecgen/necklace.hpp>
+#include <ecgen/work_stealing_pool.hpp>
+#include <mutex>
+#include <set>
+#include <span>
+#include <vector>
+
+namespace {
+    auto collect(int n, int k, ecgen::NecklaceKind kind) -> std::vector<std::vector<int>> {
+        auto words = std::vector<std::vector<int>>{};
+        ecgen::Necklaces(n, k, kind).run([&words](std::span<const int> word) {
+            words.emplace_back(word.begin(), word.end());
+            return true;
+        });
+        return words;
+    }
+
+    /// Necklaces (or Lyndon words) by comparing all rotations
+    auto brute_force(int n, int k, bool lyndon) -> std::vector<std::vector<int>> {
+        auto words = std::vector<std::vector<int>>{};
+        auto word = std::vector<int>(static_cast<std::size_t>(n), 0);
+        for (;;) {
+            auto keep = true;
+            for (auto r = 1; r < n && keep; ++r) {
+                auto rotated = word;
+                std::rotate(rotated.begin(), rotated.begin() + r, rotated.end());
+                keep = lyndon ? word < rotated : word <= rotated;
+            }
+            if (keep) {
+                words.push_back(word);
+            }
+            auto i = n - 1;
+            while (i >= 0 && word[std::size_t(i)] == k - 1) {
+                word[std::size_t(i--)] = 0;
+            }
+            if (i < 0) {
+                return words;
+            }
+            ++word[std::size_t(i)];
+        }
+    }
+}  // namespace
+
+TEST_CASE("necklaces and Lyndon words match brute force") {
+    for (auto k = 1; k != 5; ++k) {
+        for (auto n = 1; n != 8; ++n) {
+            CHECK_EQ(collect(n, k, ecgen::NecklaceKind::necklace), brute_force(n, k, false));
+            CHECK_EQ(collect(n, k, ecgen::NecklaceKind::lyndon), brute_force(n, k, true));
+        }
+    }
+}
+
+TEST_CASE("prenecklace counts") {
+    // OEIS A062692: binary prenecklaces
+    const auto expected = std::vector<std::size_t>{2, 3, 5, 8, 14, 23, 41, 71, 127, 226};
+    for (auto n = 1; n != 11; ++n) {
+        const auto pre = collect(n, 2, ecgen::NecklaceKind::prenecklace);
+        CHECK_EQ(pre.size(), expected[std::size_t(n - 1)]);
+        CHECK(std::is_sorted(pre.begin(), pre.end()));
+        const auto neck = collect(n, 2, ecgen::NecklaceKind::necklace);
+        CHECK(std::includes(pre.begin(), pre.end(), neck.begin(), neck.end()));
+    }
+    CHECK(collect(0, 2, ecgen::NecklaceKind::prenecklace).empty());
+    CHECK(collect(3, 0, ecgen::NecklaceKind::prenecklace).empty());
+}
+
+TEST_CASE("necklaces stop early") {
+    auto count = 0;
+    CHECK_FALSE(ecgen::Necklaces(12, 3).run([&count](std::span<const int>) {
+        return ++count < 25;
+    }));
+    CHECK_EQ(count, 25);
+}
+
+TEST_CASE("necklaces on a pool") {
+    auto pool = ecgen::WorkStealingPool(4);
+    for (const auto kind : {ecgen::NecklaceKind::necklace, ecgen::NecklaceKind::lyndon,
+                            ecgen::NecklaceKind::prenecklace}) {
+        auto mutex = std::mutex{};
+        auto words = std::vector<std::vector<int>>{};
+        auto gen = ecgen::Necklaces(16, 2, kind);
+        CHECK(gen.run(pool, [&](std::span<const int> word) {
+            auto lock = std::lock_guard<std::mutex>(mutex);
+            words.emplace_back(word.begin(), word.end());
+            return true;
+        }));
+        std::sort(words.begin(), words.end());
+        CHECK_EQ(words, collect(16, 2, kind));
+    }
+
+    auto count = std::atomic<long>{0};
+    CHECK(ecgen::Necklaces(24, 2).run(pool, [&count](std::span<const int>) {
+        ++count;
+        return true;
+    }));
+    CHECK_EQ(count.load(), 699252);  // OEIS A000031
+
+    count = 0;
+    CHECK_FALSE(ecgen::Necklaces(24, 2).run(pool, [&count](std::span<const int>) {
+        return ++count < 1000;
+    }));
+    CHECK(count.load() < 699252);
+    CHECK_EQ(ecgen::Necklaces(3, 2).run(pool, [](std::span<const int>) { return true; }), true);
+}
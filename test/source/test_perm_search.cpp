@@ -0,0 +1,151 @@
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <ecgen/perm.hpp>
+#include <ecgen/perm_search.hpp>
+#include <ecgen/progress.hpp>
+#include <ecgen/work_stealing_pool.hpp>
+#include <mutex>
+#include <numeric>
+#include <set>
+#include <span>
+#include <vector>
+
+namespace {
+    /// A fixed pseudo-random asymmetric distance matrix
+    auto distances(int n) -> std::vector<std::vector<int>> {
+        auto dist = std::vector<std::vector<int>>(static_cast<std::size_t>(n),
+                                                  std::vector<int>(static_cast<std::size_t>(n)));
+        auto state = 2463534242U;
+        for (auto& row : dist) {
+            for (auto& d : row) {
+                state ^= state << 13;
+                state ^= state >> 17;
+                state ^= state << 5;
+                d = 1 + int(state % 100U);
+            }
+        }
+        return dist;
+    }
+
+    auto path_cost(const std::vector<std::vector<int>>& dist, std::span<const int> path) -> int {
+        auto cost = 0;
+        for (std::size_t i = 1; i < path.size(); ++i) {
+            cost += dist[std::size_t(path[i - 1])][std::size_t(path[i])];
+        }
+        return cost;
+    }
+
+    auto tour_cost(const std::vector<std::vector<int>>& dist, std::span<const int> perm) -> int {
+        return path_cost(dist, perm) + dist[std::size_t(perm.back())][std::size_t(perm.front())];
+    }
+}  // namespace
+
+TEST_CASE("factorial at run time") {
+    CHECK_EQ(ecgen::factorial(0), 1U);
+    CHECK_EQ(ecgen::factorial(10), ecgen::Factorial<10>());
+    CHECK_EQ(ecgen::factorial(20), 2432902008176640000U);
+}
+
+TEST_CASE("perm search without pruning") {
+    auto search = ecgen::PermSearch(6);
+    auto seen = std::set<std::vector<int>>{};
+    CHECK(search.run([](std::span<const int>) { return true; },
+                     [&seen](std::span<const int> perm) {
+                         seen.emplace(perm.begin(), perm.end());
+                         return true;
+                     }));
+    CHECK_EQ(seen.size(), 720U);
+    CHECK_EQ(search.stats().leaves, 720U);
+    CHECK_EQ(search.stats().covered, 720U);
+    CHECK_EQ(search.stats().pruned, 0U);
+}
+
+TEST_CASE("perm search prunes prefixes") {
+    auto search = ecgen::PermSearch(7);
+    auto count = 0;
+    search.run([](std::span<const int> prefix) { return prefix[0] == 0; },
+               [&count](std::span<const int> perm) {
+                   CHECK_EQ(perm[0], 0);
+                   ++count;
+                   return true;
+               });
+    CHECK_EQ(count, 720);
+    CHECK_EQ(search.stats().pruned, 6U);
+    CHECK_EQ(search.stats().covered, ecgen::factorial(7));
+
+    // the split phase bounds every prefix once and counts it
+    const auto sequential = search.stats();
+    auto pool = ecgen::WorkStealingPool(2);
+    search.run(
+        pool, [](std::span<const int> prefix) { return prefix[0] == 0; },
+        [](std::span<const int>) { return true; });
+    CHECK_EQ(search.stats().nodes, sequential.nodes);
+    CHECK_EQ(search.stats().pruned, sequential.pruned);
+    CHECK_EQ(search.stats().covered, sequential.covered);
+
+    auto stopped = 0;
+    CHECK_FALSE(search.run([](std::span<const int>) { return true; },
+                           [&stopped](std::span<const int>) { return ++stopped < 10; }));
+    CHECK_EQ(stopped, 10);
+}
+
+TEST_CASE("perm search finds the optimal tour") {
+    constexpr int N = 9;
+    const auto dist = distances(N);
+
+    auto perm = std::vector<int>(N);
+    std::iota(perm.begin(), perm.end(), 0);
+    auto expected = INT_MAX;
+    do {
+        expected = std::min(expected, tour_cost(dist, perm));
+    } while (std::next_permutation(perm.begin() + 1, perm.end()));
+
+    auto best = INT_MAX;
+    auto search = ecgen::PermSearch(N);
+    search.run(
+        [&](std::span<const int> prefix) {
+            return prefix[0] == 0 && path_cost(dist, prefix) < best;
+        },
+        [&](std::span<const int> tour) {
+            best = std::min(best, tour_cost(dist, tour));
+            return true;
+        });
+    CHECK_EQ(best, expected);
+    CHECK_LT(search.stats().leaves, ecgen::factorial(N - 1));
+    CHECK_EQ(search.stats().covered, ecgen::factorial(N));
+
+    auto pool = ecgen::WorkStealingPool(3);
+    auto counter = ecgen::ProgressCounter(pool.num_workers());
+    auto shared_best = std::atomic<int>{INT_MAX};
+    auto parallel = ecgen::PermSearch(N);
+    parallel.set_progress(counter);
+    CHECK(parallel.run(
+        pool,
+        [&](std::span<const int> prefix) {
+            return prefix[0] == 0
+                   && path_cost(dist, prefix) < shared_best.load(std::memory_order_relaxed);
+        },
+        [&](std::span<const int> tour) {
+            const auto cost = tour_cost(dist, tour);
+            auto old = shared_best.load();
+            while (cost < old && !shared_best.compare_exchange_weak(old, cost)) {
+            }
+            return true;
+        }));
+    CHECK_EQ(shared_best.load(), expected);
+    CHECK_EQ(parallel.stats().covered, ecgen::factorial(N));
+    CHECK_EQ(counter.total(), ecgen::factorial(N));
+}
+
+TEST_CASE("perm search stops all workers") {
+    auto pool = ecgen::WorkStealingPool(2);
+    auto search = ecgen::PermSearch(10);
+    auto count = std::atomic<int>{0};
+    CHECK_FALSE(search.run(
+        pool, [](std::span<const int>) { return true; },
+        [&count](std::span<const int>) { return ++count < 100; }));
+    CHECK_LT(search.stats().leaves, ecgen::factorial(10));
+}
@@ -0,0 +1,58 @@
+#include <doctest/doctest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <ecgen/combin.hpp>
+#include <ecgen/progress.hpp>
+#include <thread>
+#include <vector>
+
+TEST_CASE("progress counter sums per-thread slots") {
+    auto counter = ecgen::ProgressCounter(4);
+    auto threads = std::vector<std::thread>{};
+    for (auto slot = 0U; slot != 4U; ++slot) {
+        threads.emplace_back([&counter, slot]() {
+            for (auto i = 0; i != 10000; ++i) {
+                counter.add(slot);
+            }
+            counter.add(slot, 5);
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    CHECK_EQ(counter.num_slots(), 4U);
+    CHECK_EQ(counter.total(), 4U * 10005U);
+}
+
+TEST_CASE("progress snapshot rate and eta") {
+    const auto first = ecgen::ProgressSnapshot::next(100, 1.0, ecgen::ProgressSnapshot{}, 1000);
+    CHECK_EQ(first.rate, doctest::Approx(100.0));
+    CHECK_EQ(first.fraction, doctest::Approx(0.1));
+    CHECK_EQ(first.eta, doctest::Approx(9.0));
+
+    const auto second = ecgen::ProgressSnapshot::next(400, 2.0, first, 1000);
+    CHECK_EQ(second.rate, doctest::Approx(300.0));
+    CHECK_EQ(second.eta, doctest::Approx(3.0));  // 600 left at 200/s on average
+
+    const auto unknown = ecgen::ProgressSnapshot::next(400, 2.0, first, 0);
+    CHECK_EQ(unknown.fraction, -1.0);
+    CHECK_EQ(unknown.eta, -1.0);
+
+    CHECK_EQ(ecgen::ProgressSnapshot::next(1000, 3.0, second, 1000).eta, 0.0);
+}
+
+TEST_CASE("progress reporter counts a generator") {
+    auto counter = ecgen::ProgressCounter(1);
+    auto reporter = ecgen::ProgressReporter(counter, "emk_comb", ecgen::Combination<10, 4>() - 1,
+                                            std::chrono::milliseconds(1));
+    for ([[maybe_unused]] const auto& [x, y] : ecgen::emk_comb_gen(10, 4)) {
+        counter.add(0);
+    }
+    reporter.stop();
+    reporter.stop();  // idempotent
+    const auto last = reporter.last();
+    CHECK_EQ(last.done, ecgen::Combination<10, 4>() - 1);
+    CHECK_EQ(last.fraction, doctest::Approx(1.0));
+    CHECK_EQ(last.eta, 0.0);
+}
@@ -0,0 +1,100 @@
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <ecgen/combin.hpp>
+#include <ecgen/pruned_comb.hpp>
+#include <numeric>
+#include <set>
+#include <vector>
+
+namespace {
+    auto symmetric_difference(std::vector<int> a, std::vector<int> b) -> std::size_t {
+        std::sort(a.begin(), a.end());
+        std::sort(b.begin(), b.end());
+        auto diff = std::vector<int>{};
+        std::set_symmetric_difference(a.begin(), a.end(), b.begin(), b.end(),
+                                      std::back_inserter(diff));
+        return diff.size();
+    }
+}  // namespace
+
+TEST_CASE("pruned comb without pruning is a revolving door") {
+    auto search = ecgen::PrunedComb(9, 4);
+    auto seen = std::set<std::vector<int>>{};
+    auto prev = std::vector<int>{};
+    search.run([](const auto&, int) { return true; },
+               [&](const std::vector<int>& chosen) {
+                   CHECK_EQ(chosen.size(), 4U);
+                   if (seen.empty()) {
+                       CHECK_EQ(chosen, std::vector<int>{3, 2, 1, 0});
+                   } else {
+                       CHECK_EQ(symmetric_difference(prev, chosen), 2U);
+                   }
+                   CHECK(seen.insert(chosen).second);
+                   prev = chosen;
+                   return true;
+               });
+    CHECK_EQ(seen.size(), ecgen::Combination<9, 4>());
+    CHECK_EQ(search.leaves(), seen.size());
+    CHECK_EQ(search.pruned(), 0U);
+}
+
+TEST_CASE("pruned comb skips rejected blocks") {
+    constexpr int N = 24;
+    constexpr int K = 6;
+    constexpr int LIMIT = 40;
+    auto search = ecgen::PrunedComb(N, K);
+    auto found = std::set<std::vector<int>>{};
+    search.run(
+        [](const std::vector<int>& chosen, int) {
+            return std::accumulate(chosen.begin(), chosen.end(), 0) <= LIMIT;
+        },
+        [&found](const std::vector<int>& chosen) {
+            found.insert(chosen);
+            return true;
+        });
+
+    // brute force: all 6-subsets of 0 .. 23 with sum at most 40
+    auto expected = std::set<std::vector<int>>{};
+    auto lst = std::vector<int>(N, 0);
+    std::fill_n(lst.begin(), K, 1);
+    for (const auto& comb : ecgen::emk(N, K, lst)) {
+        auto chosen = std::vector<int>{};
+        for (int i = N - 1; i >= 0; --i) {
+            if (comb[static_cast<std::size_t>(i)] != 0) {
+                chosen.push_back(i);
+            }
+        }
+        if (std::accumulate(chosen.begin(), chosen.end(), 0) <= LIMIT) {
+            expected.insert(chosen);
+        }
+    }
+    CHECK_EQ(found, expected);
+    CHECK_GT(search.pruned(), 0U);
+    CHECK_LT(search.nodes(), ecgen::Combination<N, K>() / 4);
+}
+
+TEST_CASE("pruned comb stops and handles edge cases") {
+    auto search = ecgen::PrunedComb(10, 3);
+    auto count = 0;
+    CHECK_FALSE(search.run([](const auto&, int) { return true; },
+                           [&count](const auto&) { return ++count < 5; }));
+    CHECK_EQ(count, 5);
+
+    auto sizes = std::vector<std::size_t>{};
+    auto record = [&sizes](const std::vector<int>& chosen) {
+        sizes.push_back(chosen.size());
+        return true;
+    };
+    auto any = [](const auto&, int) { return true; };
+    CHECK(ecgen::PrunedComb(5, 0).run(any, record));
+    CHECK(ecgen::PrunedComb(5, 5).run(any, record));
+    CHECK(ecgen::PrunedComb(5, 6).run(any, record));
+    CHECK_EQ(sizes, std::vector<std::size_t>{0, 5});
+
+    // rejecting every decision about element 9 leaves nothing
+    auto none = ecgen::PrunedComb(10, 3);
+    none.run([](const auto&, int element) { return element != 9; }, record);
+    CHECK_EQ(none.leaves(), 0U);
+    CHECK_EQ(none.pruned(), 2U);
+}
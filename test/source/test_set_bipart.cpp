@@ -1,6 +1,8 @@
 #include <doctest/doctest.h>
 
+#include <cstdint>
 #include <ecgen/set_bipart.hpp>
+#include <set>
 
 TEST_CASE("set bipart odd") {
     size_t cnt = 1;
@@ -25,3 +27,42 @@ TEST_CASE("set bipart special") {
     }
     CHECK_EQ(cnt, ecgen::Stirling2nd2<2>());
 }
+
+TEST_CASE("set bipart iterator matches set_bipart_gen") {
+    for (int n = 3; n != 13; ++n) {
+        auto iter = ecgen::SetBipartIterator(n);
+        auto mask = std::uint64_t{1} << (n - 1);
+        CHECK_EQ(iter.mask(), mask);
+        for (auto idx : ecgen::set_bipart_gen(n)) {
+            REQUIRE(iter.next());
+            CHECK_EQ(iter.element(), idx);
+            mask ^= std::uint64_t{1} << (idx - 1);
+            CHECK_EQ(iter.mask(), mask);
+        }
+        CHECK_FALSE(iter.next());
+    }
+}
+
+TEST_CASE("set bipart iterator visits every bipartition once") {
+    constexpr int N = 10;
+    auto seen = std::set<std::uint64_t>{};
+    auto iter = ecgen::SetBipartIterator(N);
+    seen.insert(iter.mask());
+    while (iter.next()) {
+        CHECK_EQ(iter.mask() & 1U, 0U);  // element 1 stays in the first block
+        CHECK_NE(iter.mask(), 0U);
+        seen.insert(iter.mask());
+    }
+    CHECK_EQ(seen.size(), ecgen::Stirling2nd2<N>());
+}
+
+TEST_CASE("set bipart iterator special") {
+    auto iter = ecgen::SetBipartIterator(2);
+    CHECK_FALSE(iter.next());
+}
+
+TEST_CASE("set bipart iterator rejects sizes beyond the mask") {
+    auto iter = ecgen::SetBipartIterator(65);
+    CHECK_FALSE(iter.next());
+    CHECK_EQ(iter.mask(), 0U);
+}
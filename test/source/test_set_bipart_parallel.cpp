@@ -0,0 +1,68 @@
+#include <doctest/doctest.h>
+
+#include <bit>  // for popcount
+#include <cstdint>
+#include <ecgen/set_bipart.hpp>
+#include <ecgen/set_bipart_parallel.hpp>
+#include <set>
+
+namespace {
+    struct CountReducer {
+        std::uint64_t count{0};
+        void operator()(std::uint64_t /* mask */, int /* moved */) { ++this->count; }
+        void merge(const CountReducer& other) { this->count += other.count; }
+    };
+
+    auto scramble(std::uint64_t mask) -> std::uint64_t {
+        mask *= 0x9E3779B97F4A7C15ULL;
+        return (mask ^ (mask >> 29)) % 1000U;
+    }
+}  // namespace
+
+TEST_CASE("set bipart shard is a Gray code run") {
+    constexpr int N = 9;
+    constexpr int FIXED = 3;
+    auto seen = std::set<std::uint64_t>{};
+    for (auto pattern = std::uint64_t{0}; pattern != (1U << FIXED); ++pattern) {
+        auto prev = std::uint64_t{0};
+        ecgen::set_bipart_shard(N, FIXED, pattern, [&](std::uint64_t mask, int moved) {
+            if (moved != 0) {
+                CHECK_EQ(mask ^ prev, std::uint64_t{1} << (moved - 1));
+            }
+            CHECK_EQ(mask >> (N - FIXED), pattern);
+            CHECK_EQ(mask & 1U, 0U);
+            prev = mask;
+            seen.insert(mask);
+        });
+    }
+    CHECK_EQ(seen.size(), ecgen::Stirling2nd2<N>());
+    CHECK_EQ(seen.count(0), 0);
+}
+
+TEST_CASE("set bipart parallel reduce counts all bipartitions") {
+    constexpr int N = 16;
+    for (auto num_workers : {1U, 3U, 8U}) {
+        const auto result = ecgen::set_bipart_parallel_reduce(
+            N, []() { return CountReducer{}; }, num_workers);
+        CHECK_EQ(result.count, ecgen::Stirling2nd2<N>());
+    }
+    CHECK_EQ(ecgen::set_bipart_parallel_reduce(3, []() { return CountReducer{}; }).count, 3);
+}
+
+TEST_CASE("set bipart min agrees with a serial sweep") {
+    constexpr int N = 14;
+    auto iter = ecgen::SetBipartIterator(N);
+    auto best = std::make_pair(scramble(iter.mask()), iter.mask());
+    while (iter.next()) {
+        best = std::min(best, std::make_pair(scramble(iter.mask()), iter.mask()));
+    }
+    CHECK_EQ(ecgen::set_bipart_min(N, scramble, 4), best);
+
+    // balanced bisection: penalise unequal block sizes
+    const auto [cost, mask] = ecgen::set_bipart_min(N, [](std::uint64_t mask) {
+        const auto ones = std::popcount(mask);
+        return ones > N / 2 ? ones - N / 2 : N / 2 - ones;
+    });
+    CHECK_EQ(cost, 0);
+    CHECK_EQ(std::popcount(mask), N / 2);
+}
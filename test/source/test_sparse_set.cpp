@@ -0,0 +1,84 @@
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <ecgen/sparse_set.hpp>
+#include <set>
+#include <vector>
+
+namespace {
+    template <typename Set> auto members(const Set& set) -> std::set<int> {
+        auto result = std::set<int>{};
+        for (const auto x : set) {
+            result.insert(int(x));
+        }
+        return result;
+    }
+}  // namespace
+
+TEST_CASE("sparse set basic operations") {
+    auto set = ecgen::SparseSet<std::uint8_t, 200>{};
+    CHECK(set.empty());
+    CHECK_EQ(set.capacity(), 200U);
+    CHECK(set.insert(3));
+    CHECK(set.insert(199));
+    CHECK_FALSE(set.insert(3));
+    CHECK(set.contains(3));
+    CHECK_FALSE(set.contains(4));
+    CHECK_EQ(set.size(), 2U);
+    CHECK(set.erase(3));
+    CHECK_FALSE(set.erase(3));
+    CHECK_EQ(members(set), std::set<int>{199});
+    set.clear();
+    CHECK(set.empty());
+    CHECK_FALSE(set.contains(199));
+    set.fill();
+    CHECK_EQ(set.size(), 200U);
+    CHECK(set.contains(0));
+}
+
+TEST_CASE("sparse set matches std::set") {
+    auto set = ecgen::DynamicSparseSet<std::uint16_t>(1000);
+    auto reference = std::set<int>{};
+    auto state = 12345U;
+    for (auto step = 0; step != 20000; ++step) {
+        state = state * 1103515245U + 12345U;
+        const auto x = static_cast<std::uint16_t>((state >> 8) % 1000U);
+        if ((state >> 20) % 3 == 0) {
+            CHECK_EQ(set.erase(x), reference.erase(x) == 1);
+        } else {
+            CHECK_EQ(set.insert(x), reference.insert(x).second);
+        }
+    }
+    CHECK_EQ(members(set), reference);
+}
+
+TEST_CASE("sparse set restore undoes erasures") {
+    auto set = ecgen::DynamicSparseSet<std::uint32_t>(10);
+    set.fill();
+    const auto mark = set.size();
+    set.erase(4);
+    set.erase(0);
+    const auto mark2 = set.size();
+    CHECK_EQ(set.erase_if([](std::uint32_t x) { return x % 2 == 1; }), 5U);
+    CHECK_EQ(members(set), std::set<int>{2, 6, 8});
+    set.restore(mark2);
+    CHECK_EQ(members(set), std::set<int>{1, 2, 3, 5, 6, 7, 8, 9});
+    set.restore(mark);
+    CHECK_EQ(set.size(), 10U);
+}
+
+TEST_CASE("sparse set bulk insert and merge") {
+    auto a = ecgen::SparseSet<std::uint8_t, 64>{};
+    const auto values = std::vector<int>{5, 9, 5, 63, 0};
+    a.insert(values.begin(), values.end());
+    CHECK_EQ(members(a), std::set<int>{0, 5, 9, 63});
+
+    auto b = ecgen::DynamicSparseSet<std::uint8_t>(64);
+    b.insert(9);
+    b.insert(10);
+    b.merge(a);
+    CHECK_EQ(members(b), std::set<int>{0, 5, 9, 10, 63});
+    a.merge(b);
+    CHECK_EQ(members(a), members(b));
+}
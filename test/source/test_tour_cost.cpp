@@ -0,0 +1,159 @@
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <ecgen/perm.hpp>
+#include <ecgen/tour_cost.hpp>
+#include <ecgen/work_stealing_pool.hpp>
+#include <numeric>
+#include <set>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace {
+    /// A fixed pseudo-random asymmetric distance matrix
+    template <typename T> auto random_matrix(int n) -> std::vector<std::vector<T>> {
+        auto dist = std::vector<std::vector<T>>(static_cast<std::size_t>(n),
+                                                std::vector<T>(static_cast<std::size_t>(n)));
+        auto state = 88172645U;
+        for (auto& row : dist) {
+            for (auto& d : row) {
+                state ^= state << 13;
+                state ^= state >> 17;
+                state ^= state << 5;
+                d = T(1 + int(state % 1000U)) / T(7);
+            }
+        }
+        return dist;
+    }
+
+    /// All (cost, order) pairs by next_permutation, sorted
+    auto brute_force(const std::vector<std::vector<int>>& dist, int n, bool closed)
+        -> std::vector<std::pair<int, std::vector<int>>> {
+        auto all = std::vector<std::pair<int, std::vector<int>>>{};
+        auto perm = std::vector<int>(static_cast<std::size_t>(n));
+        std::iota(perm.begin(), perm.end(), 0);
+        const auto first = perm.begin() + (closed ? 1 : 0);
+        do {
+            all.emplace_back(ecgen::tour_cost(dist, std::span<const int>(perm), closed), perm);
+        } while (std::next_permutation(first, perm.end()));
+        std::sort(all.begin(), all.end());
+        return all;
+    }
+}  // namespace
+
+TEST_CASE("SjtIndex matches sjt_gen") {
+    for (auto n = 2; n != 8; ++n) {
+        auto expected = std::vector<int>{};
+        for (const auto idx : ecgen::sjt_gen(n)) {
+            expected.push_back(idx);
+        }
+        expected.pop_back();  // the swap back to the start
+        auto sjt = ecgen::SjtIndex(n);
+        auto actual = std::vector<int>{};
+        for (auto idx = sjt.next(); idx >= 0; idx = sjt.next()) {
+            actual.push_back(idx);
+        }
+        CHECK_EQ(actual, expected);
+        CHECK_EQ(sjt.next(), -1);
+    }
+    CHECK_EQ(ecgen::SjtIndex(1).next(), -1);
+    CHECK_EQ(ecgen::SjtIndex(0).next(), -1);
+}
+
+TEST_CASE("tour cost sweep keeps the cost up to date") {
+    const auto dist = random_matrix<int>(7);
+    for (const auto closed : {true, false}) {
+        auto seen = std::set<std::vector<int>>{};
+        auto exact = true;
+        CHECK(ecgen::tour_cost_sweep(
+            dist, 7,
+            [&](std::span<const int> perm, int cost) {
+                exact = exact && cost == ecgen::tour_cost(dist, perm, closed);
+                seen.emplace(perm.begin(), perm.end());
+                return true;
+            },
+            closed));
+        CHECK(exact);
+        CHECK_EQ(seen.size(), ecgen::factorial(closed ? 6 : 7));
+        if (closed) {
+            CHECK(std::all_of(seen.begin(), seen.end(), [](const auto& p) { return p[0] == 0; }));
+        }
+    }
+
+    auto count = 0;
+    CHECK_FALSE(ecgen::tour_cost_sweep(dist, 7, [&](std::span<const int>, int) {
+        return ++count < 10;
+    }));
+    CHECK_EQ(count, 10);
+
+    count = 0;
+    CHECK(ecgen::tour_cost_sweep(dist, 1, [&](std::span<const int>, int cost) {
+        count += 1 + cost;
+        return true;
+    }));
+    CHECK_EQ(count, 1);
+}
+
+TEST_CASE("tour cost top k matches brute force") {
+    const auto dist = random_matrix<int>(8);
+    for (const auto closed : {true, false}) {
+        const auto all = brute_force(dist, 8, closed);
+        const auto top = ecgen::tour_cost_top_k(dist, 8, 5, closed);
+        REQUIRE_EQ(top.size(), 5U);
+        for (std::size_t i = 0; i != top.size(); ++i) {
+            CHECK_EQ(top[i].cost, all[i].first);
+            CHECK_EQ(top[i].order, all[i].second);
+        }
+    }
+    CHECK(ecgen::tour_cost_top_k(dist, 8, 0).empty());
+    CHECK_EQ(ecgen::tour_cost_top_k(dist, 4, 100).size(), 6U);
+}
+
+TEST_CASE("tour cost sweep on a pool") {
+    auto pool = ecgen::WorkStealingPool(4);
+    const auto dist = random_matrix<int>(9);
+    auto count = std::atomic<long>{0};
+    auto exact = std::atomic<bool>{true};
+    CHECK(ecgen::tour_cost_sweep(pool, dist, 9, [&](std::span<const int> perm, int cost) {
+        if (cost != ecgen::tour_cost(dist, perm)) {
+            exact = false;
+        }
+        ++count;
+        return true;
+    }));
+    CHECK(exact.load());
+    CHECK_EQ(count.load(), 40320);
+
+    for (const auto closed : {true, false}) {
+        const auto sequential = ecgen::tour_cost_top_k(dist, 9, 7, closed);
+        const auto parallel = ecgen::tour_cost_top_k(pool, dist, 9, 7, closed);
+        REQUIRE_EQ(parallel.size(), sequential.size());
+        for (std::size_t i = 0; i != parallel.size(); ++i) {
+            CHECK_EQ(parallel[i].cost, sequential[i].cost);
+            CHECK_EQ(parallel[i].order, sequential[i].order);
+        }
+    }
+    CHECK_EQ(ecgen::tour_cost_top_k(pool, dist, 3, 10).size(), 2U);
+
+    count = 0;
+    CHECK_FALSE(ecgen::tour_cost_sweep(pool, dist, 9, [&](std::span<const int>, int) {
+        return ++count < 100;
+    }));
+}
+
+TEST_CASE("tour cost sweep with floating-point distances") {
+    const auto dist = random_matrix<double>(9);
+    auto worst = 0.0;
+    ecgen::tour_cost_sweep(dist, 9, [&](std::span<const int> perm, double cost) {
+        worst = std::max(worst, std::abs(cost - ecgen::tour_cost(dist, perm)));
+        return true;
+    });
+    CHECK(worst < 1e-9);
+    const auto top = ecgen::tour_cost_top_k(dist, 9, 3);
+    REQUIRE_EQ(top.size(), 3U);
+    CHECK_EQ(top[0].cost, ecgen::tour_cost(dist, std::span<const int>(top[0].order)));
+    CHECK(top[0].cost <= top[1].cost);
+}
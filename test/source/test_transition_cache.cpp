@@ -0,0 +1,86 @@
+#include <doctest/doctest.h>
+
+#include <ecgen/combin.hpp>
+#include <ecgen/set_partition.hpp>
+#include <ecgen/transition_cache.hpp>
+#include <filesystem>
+#include <fstream>
+#include <utility>  // for pair
+#include <vector>
+
+namespace {
+    template <typename Gen> auto collect(Gen&& gen) -> std::vector<std::pair<int, int>> {
+        auto moves = std::vector<std::pair<int, int>>{};
+        for (const auto& move : gen) {
+            moves.push_back(move);
+        }
+        return moves;
+    }
+
+    template <typename Table> auto collect_table(const Table& table) {
+        return std::vector<std::pair<int, int>>(table.begin(), table.end());
+    }
+}  // namespace
+
+TEST_CASE("transition table matches the generators") {
+    const auto dir = std::filesystem::temp_directory_path() / "ecgen_test_cache";
+    std::filesystem::remove_all(dir);
+    std::filesystem::create_directories(dir);
+
+    const auto comb = ecgen::TransitionTable::load(dir.string(), ecgen::TransitionKind::emk_comb,
+                                                   12, 5);
+    REQUIRE(comb.has_value());
+    CHECK_EQ(comb->size(), ecgen::Combination<12, 5>() - 1);
+    CHECK_EQ(collect_table(*comb), collect(ecgen::emk_comb_gen(12, 5)));
+    CHECK_EQ((*comb)[3], collect(ecgen::emk_comb_gen(12, 5))[3]);
+
+    const auto part = ecgen::TransitionTable::load(
+        dir.string(), ecgen::TransitionKind::set_partition, 9, 4);
+    REQUIRE(part.has_value());
+    CHECK_EQ(part->size(), ecgen::Stirling2nd<9, 4>() - 1);
+    CHECK_EQ(collect_table(*part), collect(ecgen::set_partition_gen(9, 4)));
+
+    // a second load maps the existing file
+    const auto path
+        = dir / ecgen::TransitionTable::file_name(ecgen::TransitionKind::emk_comb, 12, 5);
+    const auto stamp = std::filesystem::last_write_time(path);
+    const auto again = ecgen::TransitionTable::load(dir.string(),
+                                                    ecgen::TransitionKind::emk_comb, 12, 5);
+    REQUIRE(again.has_value());
+    CHECK_EQ(std::filesystem::last_write_time(path), stamp);
+    CHECK_EQ(collect_table(*again), collect_table(*comb));
+
+    std::filesystem::remove_all(dir);
+}
+
+TEST_CASE("transition table rebuilds invalid files") {
+    const auto dir = std::filesystem::temp_directory_path() / "ecgen_test_cache_bad";
+    std::filesystem::remove_all(dir);
+    std::filesystem::create_directories(dir);
+    const auto path
+        = dir / ecgen::TransitionTable::file_name(ecgen::TransitionKind::emk_comb, 8, 3);
+    {
+        auto file = std::ofstream(path, std::ios::binary);
+        file << "ECGTRANS truncated";
+    }
+    const auto table = ecgen::TransitionTable::load(dir.string(),
+                                                    ecgen::TransitionKind::emk_comb, 8, 3);
+    REQUIRE(table.has_value());
+    CHECK_EQ(collect_table(*table), collect(ecgen::emk_comb_gen(8, 3)));
+
+    const auto empty = ecgen::TransitionTable::load(dir.string(),
+                                                    ecgen::TransitionKind::emk_comb, 8, 0);
+    REQUIRE(empty.has_value());
+    CHECK_EQ(empty->size(), 0U);
+    CHECK(empty->begin() == empty->end());
+
+    CHECK_FALSE(ecgen::TransitionTable::load(dir.string(), ecgen::TransitionKind::emk_comb, 8, 9)
+                    .has_value());
+    CHECK_FALSE(ecgen::TransitionTable::load(dir.string(), ecgen::TransitionKind::emk_comb, 300,
+                                             2)
+                    .has_value());
+    CHECK_FALSE(ecgen::TransitionTable::load((dir / "missing").string(),
+                                             ecgen::TransitionKind::emk_comb, 8, 3)
+                    .has_value());
+    std::filesystem::remove_all(dir);
+}
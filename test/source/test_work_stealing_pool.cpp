@@ -0,0 +1,115 @@
+#include <doctest/doctest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <ecgen/work_stealing_pool.hpp>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+    auto fib(ecgen::WorkStealingPool& pool, int n) -> std::uint64_t {
+        if (n < 12) {
+            return n < 2 ? std::uint64_t(n) : fib(pool, n - 1) + fib(pool, n - 2);
+        }
+        auto a = std::uint64_t{0};
+        auto b = std::uint64_t{0};
+        pool.join([&]() { a = fib(pool, n - 1); }, [&]() { b = fib(pool, n - 2); });
+        return a + b;
+    }
+}  // namespace
+
+TEST_CASE("work stealing deque") {
+    auto deque = ecgen::WorkStealingDeque(2);
+    auto runs = 0;
+    auto body = [&runs]() { ++runs; };
+    auto tasks = std::vector<std::unique_ptr<ecgen::PoolTask>>{};
+    for (auto i = 0; i != 10; ++i) {
+        tasks.push_back(std::make_unique<ecgen::PoolTask>(body));
+        deque.push(tasks.back().get());  // grows past the initial capacity
+    }
+    CHECK_EQ(deque.steal(), tasks[0].get());  // oldest first
+    CHECK_EQ(deque.pop(), tasks[9].get());    // newest first
+    auto count = 2;
+    while (auto* task = deque.pop()) {
+        task->execute();
+        ++count;
+    }
+    CHECK_EQ(count, 10);
+    CHECK_EQ(runs, 8);
+    CHECK(deque.empty());
+    CHECK_EQ(deque.steal(), nullptr);
+}
+
+TEST_CASE("work stealing pool parallel for") {
+    auto pool = ecgen::WorkStealingPool(4);
+    REQUIRE_EQ(pool.num_workers(), 4U);
+    CHECK_EQ(pool.worker_index(), -1);
+
+    auto sums = std::vector<std::uint64_t>(pool.num_workers(), 0);
+    auto bad_index = std::atomic<int>{0};
+    pool.parallel_for(0, 100000, [&](std::size_t i) {
+        const auto index = pool.worker_index();
+        if (index < 0 || index >= 4) {
+            ++bad_index;
+            return;
+        }
+        sums[static_cast<std::size_t>(index)] += i;
+    });
+    CHECK_EQ(bad_index.load(), 0);
+    CHECK_EQ(std::accumulate(sums.begin(), sums.end(), std::uint64_t{0}),
+             std::uint64_t{100000} * 99999 / 2);
+
+    auto hits = std::vector<std::atomic<int>>(1000);
+    pool.parallel_for(0, hits.size(), [&](std::size_t i) { ++hits[i]; }, 7);
+    auto all_once = true;
+    for (const auto& hit : hits) {
+        all_once = all_once && hit.load() == 1;
+    }
+    CHECK(all_once);
+}
+
+TEST_CASE("work stealing pool nested join") {
+    auto pool = ecgen::WorkStealingPool(3);
+    CHECK_EQ(fib(pool, 27), 196418U);
+
+    // several outside threads share the pool
+    auto results = std::vector<std::uint64_t>(4, 0);
+    auto callers = std::vector<std::thread>{};
+    for (std::size_t i = 0; i != results.size(); ++i) {
+        callers.emplace_back([&pool, &results, i]() {
+            pool.run([&]() { results[i] = fib(pool, 20 + int(i)); });
+        });
+    }
+    for (auto& caller : callers) {
+        caller.join();
+    }
+    CHECK_EQ(results, std::vector<std::uint64_t>{6765, 10946, 17711, 28657});
+}
+
+TEST_CASE("work stealing pool rethrows exceptions") {
+    auto pool = ecgen::WorkStealingPool(3);
+    auto visited = std::atomic<int>{0};
+    CHECK_THROWS_AS(pool.parallel_for(0, 1000,
+                                      [&](std::size_t i) {
+                                          ++visited;
+                                          if (i == 617) {
+                                              throw std::runtime_error("617");
+                                          }
+                                      }),
+                    std::runtime_error);
+    CHECK_GT(visited.load(), 0);
+
+    // from either side of a nested join
+    auto throw_second = [&]() {
+        pool.join([]() {}, []() { throw std::logic_error("fn2"); });
+    };
+    CHECK_THROWS_AS(pool.run([&]() { pool.join([]() {}, throw_second); }), std::logic_error);
+    CHECK_THROWS_AS(pool.join([]() { throw std::logic_error("fn1"); }, []() {}),
+                    std::logic_error);
+
+    // the pool stays usable
+    CHECK_EQ(fib(pool, 24), 46368U);
+}
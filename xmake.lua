@@ -35,6 +35,9 @@ add_includedirs("include", { public = true })
 add_includedirs("../py2cpp/include", { public = true })
 add_files("source/*.cpp")
 add_packages("fmt", "spdlog")
+if is_plat("linux") then
+	add_syslinks("pthread", { public = true })
+end
 
 target("test_ecgen")
 set_kind("binary")
@@ -59,6 +62,55 @@ add_includedirs("include", { public = true })
 add_files("bench/BM_set_partition.cpp")
 add_packages("benchmark")
 
+target("test_set_bipart")
+set_kind("binary")
+add_deps("Ecgen")
+add_includedirs("include", { public = true })
+add_files("bench/BM_set_bipart.cpp")
+add_packages("benchmark")
+
+target("test_bipart_cut")
+set_kind("binary")
+add_deps("Ecgen")
+add_includedirs("include", { public = true })
+add_files("bench/BM_bipart_cut.cpp")
+add_packages("benchmark")
+
+target("test_diff_cover")
+set_kind("binary")
+add_deps("Ecgen")
+add_includedirs("include", { public = true })
+add_files("bench/BM_diff_cover.cpp")
+add_packages("benchmark")
+
+target("test_coollex")
+set_kind("binary")
+add_deps("Ecgen")
+add_includedirs("include", { public = true })
+add_files("bench/BM_coollex.cpp")
+add_packages("benchmark")
+
+target("test_tour_cost")
+set_kind("binary")
+add_deps("Ecgen")
+add_includedirs("include", { public = true })
+add_files("bench/BM_tour_cost.cpp")
+add_packages("benchmark")
+
+target("test_necklace")
+set_kind("binary")
+add_deps("Ecgen")
+add_includedirs("include", { public = true })
+add_files("bench/BM_necklace.cpp")
+add_packages("benchmark")
+
+target("test_de_bruijn")
+set_kind("binary")
+add_deps("Ecgen")
+add_includedirs("include", { public = true })
+add_files("bench/BM_de_bruijn.cpp")
+add_packages("benchmark")
+
 target("spdlog_example")
 set_kind("binary")
 add_deps("Ecgen")